@@ -0,0 +1,99 @@
+/**
+ * Affine texture mapping with the interpolators, see affine.h
+ */
+
+#include "hardware/interp.h"
+#include "affine.h"
+
+// Lane 0 turns u into the texel column, lane 1 v into the row times the
+// width, and base 2 adds the texture, so pop[2] is the texel address and
+// also steps u and v by du and dv.
+static void setup_interp(const vga_texture_t *tex)
+{
+    interp_config c = interp_default_config();
+    interp_config_set_add_raw(&c, true);
+    interp_config_set_shift(&c, AFFINE_FRACTION_BITS);
+    interp_config_set_mask(&c, 0, tex->width_bits - 1);
+    interp_set_config(interp0, 0, &c);
+
+    interp_config_set_shift(&c, AFFINE_FRACTION_BITS - tex->width_bits);
+    interp_config_set_mask(&c, tex->width_bits, tex->width_bits + tex->height_bits - 1);
+    interp_set_config(interp0, 1, &c);
+
+    interp0->base[2] = (uintptr_t)tex->pixels;
+}
+
+static inline uint32_t texel()
+{
+    return *(const uint8_t *)interp0->pop[2];
+}
+
+// Pixels x0..x1 of a row (already clipped) from the interpolator
+static void VGA_RAM_FUNC(affine_span)(uint32_t *row, int x0, int x1)
+{
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    for (int i = w0; i <= w1; i++)
+    {
+        int first = (i == w0) ? x0 % 5 : 0;
+        int last = (i == w1) ? x1 % 5 : 4;
+
+        if (first == 0 && last == 4)
+        {
+            uint32_t p0 = texel();
+            uint32_t p1 = texel();
+            uint32_t p2 = texel();
+            uint32_t p3 = texel();
+            uint32_t p4 = texel();
+            row[i] = (p0 << 24) | (p1 << 18) | (p2 << 12) | (p3 << 6) | p4;
+        }
+        else
+        {
+            uint32_t value = 0;
+            for (int p = first; p <= last; p++)
+                value |= texel() << VGA_PIXEL_SHIFT(p);
+            uint32_t mask = VGA_SPAN_MASK(first, last);
+            row[i] = (row[i] & ~mask) | (value & mask);
+        }
+    }
+}
+
+void VGA_RAM_FUNC(blitAffineLines)(const vga_texture_t *tex, int x, int y, int w, int h, affine_line_fn line_fn, void *ctx)
+{
+    int x0 = x < 0 ? 0 : x;
+    int x1 = x + w > VGA_WIDTH ? VGA_WIDTH - 1 : x + w - 1;
+    int y0 = y < 0 ? 0 : y;
+    int y1 = y + h > VGA_HEIGHT ? VGA_HEIGHT - 1 : y + h - 1;
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    setup_interp(tex);
+    for (int row = y0; row <= y1; row++)
+    {
+        affine_line_t line;
+        line_fn(row - y, &line, ctx);
+
+        // Start at the first visible pixel
+        interp0->accum[0] = line.u + (x0 - x) * line.du;
+        interp0->accum[1] = line.v + (x0 - x) * line.dv;
+        interp0->base[0] = line.du;
+        interp0->base[1] = line.dv;
+        affine_span(vga_row(row), x0, x1);
+    }
+}
+
+static void matrix_line(int y, affine_line_t *line, void *ctx)
+{
+    const int32_t *m = ctx;
+
+    line->u = m[1] * y + m[4];
+    line->v = m[3] * y + m[5];
+    line->du = m[0];
+    line->dv = m[2];
+}
+
+void blitAffine(const vga_texture_t *tex, int x, int y, int w, int h, const int32_t m[6])
+{
+    blitAffineLines(tex, x, y, w, h, matrix_line, (void *)m);
+}
@@ -0,0 +1,39 @@
+/**
+ * Affine texture mapping: rotation, zoom, shear and "Mode 7" floors
+ *
+ * Pixel x of a destination line samples the texture at (u + x * du,
+ * v + x * dv), with the four values chosen per line in 16.16 fixed point.
+ * The texture repeats in both directions. Texel addresses are generated by
+ * interpolator 0 of the calling core, so both cores can draw at once, but
+ * interrupt handlers must not use interpolator 0 without saving it.
+ */
+
+#ifndef AFFINE_H
+#define AFFINE_H
+
+#include "vga.h"
+
+#define AFFINE_FRACTION_BITS 16
+#define AFFINE_ONE (1 << AFFINE_FRACTION_BITS)
+
+// Texture coordinates of the first pixel of a line and their step per pixel
+typedef struct
+{
+    int32_t u;
+    int32_t v;
+    int32_t du;
+    int32_t dv;
+} affine_line_t;
+
+// Fills in the mapping for line y (0 is the top of the rectangle)
+typedef void (*affine_line_fn)(int y, affine_line_t *line, void *ctx);
+
+// Fill a w x h rectangle at (x, y) with a different mapping on every line
+void blitAffineLines(const vga_texture_t *tex, int x, int y, int w, int h, affine_line_fn line_fn, void *ctx);
+
+// Fill a w x h rectangle at (x, y) with one mapping: pixel (i, j) of the
+// rectangle samples u = m[0] * i + m[1] * j + m[4], v = m[2] * i + m[3] * j +
+// m[5], all 16.16
+void blitAffine(const vga_texture_t *tex, int x, int y, int w, int h, const int32_t m[6]);
+
+#endif
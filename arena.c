@@ -0,0 +1,150 @@
+/**
+ * Memory for surfaces, sprites and line buffers, see arena.h
+ */
+
+#include "arena.h"
+
+void arena_init(arena_t *arena, uint32_t *memory, int words)
+{
+    arena->next = memory;
+    arena->end = memory + words;
+    arena->used = 0;
+}
+
+static uint32_t *carve(arena_t *arena, int words)
+{
+    if (words <= 0 || words > arena->end - arena->next)
+        return NULL;
+
+    uint32_t *p = arena->next;
+    arena->next += words;
+    arena->used += words;
+    return p;
+}
+
+bool arena_pool_init(arena_pool_t *pool, arena_t *arena, int block_words, int blocks)
+{
+    // A free block holds the link to the next one
+    if (block_words < 1)
+        block_words = 1;
+
+    uint32_t *memory = carve(arena, block_words * blocks);
+    if (!memory)
+        return false;
+
+    pool->block_words = block_words;
+    pool->blocks = blocks;
+    pool->used = 0;
+    pool->high_water = 0;
+    pool->failures = 0;
+    pool->free = NULL;
+    for (int i = blocks - 1; i >= 0; i--)
+    {
+        uint32_t *block = memory + i * block_words;
+        *(uint32_t **)block = pool->free;
+        pool->free = block;
+    }
+    return true;
+}
+
+bool arena_scratch_init(arena_scratch_t *scratch, arena_t *arena, int words)
+{
+    uint32_t *memory = carve(arena, words);
+    if (!memory)
+        return false;
+
+    scratch->base = memory;
+    scratch->words = words;
+    scratch->used = 0;
+    scratch->high_water = 0;
+    scratch->frame = vga_frame_count();
+    scratch->failures = 0;
+    return true;
+}
+
+uint32_t *arena_pool_alloc(arena_pool_t *pool)
+{
+    uint32_t *block = pool->free;
+    if (!block)
+    {
+        pool->failures++;
+        return NULL;
+    }
+
+    pool->free = *(uint32_t **)block;
+    if (++pool->used > pool->high_water)
+        pool->high_water = pool->used;
+    return block;
+}
+
+void arena_pool_free(arena_pool_t *pool, uint32_t *block)
+{
+    if (!block)
+        return;
+
+    *(uint32_t **)block = pool->free;
+    pool->free = block;
+    pool->used--;
+}
+
+void arena_scratch_reset(arena_scratch_t *scratch)
+{
+    scratch->used = 0;
+    scratch->frame = vga_frame_count();
+}
+
+uint32_t *arena_scratch_alloc(arena_scratch_t *scratch, int words)
+{
+    if (scratch->frame != vga_frame_count())
+        arena_scratch_reset(scratch);
+
+    if (words < 0 || words > scratch->words - scratch->used)
+    {
+        scratch->failures++;
+        return NULL;
+    }
+
+    uint32_t *p = scratch->base + scratch->used;
+    scratch->used += words;
+    if (scratch->used > scratch->high_water)
+        scratch->high_water = scratch->used;
+    return p;
+}
+
+static void set_surface(vga_surface_t *s, uint32_t *words, int w, int h)
+{
+    s->words = words;
+    s->width = w;
+    s->height = h;
+    s->stride = ARENA_SURFACE_WORDS(w, 1);
+}
+
+bool arena_pool_surface(arena_pool_t *pool, vga_surface_t *s, int w, int h)
+{
+    if (w <= 0 || h <= 0 || ARENA_SURFACE_WORDS(w, h) > pool->block_words)
+        return false;
+
+    uint32_t *words = arena_pool_alloc(pool);
+    if (!words)
+        return false;
+    set_surface(s, words, w, h);
+    return true;
+}
+
+bool arena_scratch_surface(arena_scratch_t *scratch, vga_surface_t *s, int w, int h)
+{
+    if (w <= 0 || h <= 0)
+        return false;
+
+    uint32_t *words = arena_scratch_alloc(scratch, ARENA_SURFACE_WORDS(w, h));
+    if (!words)
+        return false;
+    set_surface(s, words, w, h);
+    return true;
+}
+
+void arena_surface_free(arena_pool_t *pool, vga_surface_t *s)
+{
+    arena_pool_free(pool, s->words);
+    s->words = NULL;
+}
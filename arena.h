@@ -0,0 +1,81 @@
+/**
+ * Memory for surfaces, sprites and line buffers without the heap
+ *
+ * An arena is a block of words the application sets aside (a static array)
+ * and carves up once at startup into:
+ *  - pools of equal blocks, for line buffers, sprites and other surfaces
+ *    that come and go. Taking and giving back a block is O(1) through a
+ *    free list kept in the free blocks themselves, so there is nothing to
+ *    fragment.
+ *  - scratch regions, allocated from by moving a pointer and emptied at the
+ *    start of every frame. What comes from scratch is only good until the
+ *    frame it was allocated in has been sent.
+ * Everything is whole words, so every surface row starts on a word like the
+ * packed format needs. Each part counts how much it has in use and the
+ * most it ever had, to size them from a running system.
+ *
+ * Nothing here locks; use each pool and scratch region from one core.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "vga.h"
+
+// Words of a w x h surface
+#define ARENA_SURFACE_WORDS(w, h) ((((w) + VGA_PIXELS_PER_WORD - 1) / VGA_PIXELS_PER_WORD) * (h))
+
+typedef struct
+{
+    uint32_t *next;
+    uint32_t *end;
+    int used; // words carved
+} arena_t;
+
+typedef struct
+{
+    uint32_t *free; // first free block, whose first word points to the next
+    int block_words;
+    int blocks;
+    int used;
+    int high_water; // blocks
+    uint32_t failures;
+} arena_pool_t;
+
+typedef struct
+{
+    uint32_t *base;
+    int words;
+    int used;
+    int high_water; // words in one frame
+    uint32_t frame; // vga_frame_count() when last emptied
+    uint32_t failures;
+} arena_scratch_t;
+
+void arena_init(arena_t *arena, uint32_t *memory, int words);
+
+// Carve a pool of blocks of at least block_words words, or a scratch region.
+// Returns false if the arena doesn't have the room left.
+bool arena_pool_init(arena_pool_t *pool, arena_t *arena, int block_words, int blocks);
+bool arena_scratch_init(arena_scratch_t *scratch, arena_t *arena, int words);
+
+// A block, NULL if all are in use
+uint32_t *arena_pool_alloc(arena_pool_t *pool);
+void arena_pool_free(arena_pool_t *pool, uint32_t *block);
+
+// Words from scratch, good until the current frame has been sent. NULL if
+// the region is full for this frame.
+uint32_t *arena_scratch_alloc(arena_scratch_t *scratch, int words);
+
+// Empty a scratch region now, for use outside of the frame cycle
+void arena_scratch_reset(arena_scratch_t *scratch);
+
+// Set up a w x h surface in a pool block or scratch. Returns false if there
+// is no block, the block is too small or scratch is full.
+bool arena_pool_surface(arena_pool_t *pool, vga_surface_t *s, int w, int h);
+bool arena_scratch_surface(arena_scratch_t *scratch, vga_surface_t *s, int w, int h);
+
+// Give a surface from arena_pool_surface() back to its pool
+void arena_surface_free(arena_pool_t *pool, vga_surface_t *s);
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * Images built into the firmware
+ */
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "vga.h"
+
+#define ASSET_PALETTE 0
+#define ASSET_TARGET 1
+#define ASSET_COUNT 2
+
+extern const vga_surface_t vga_assets[ASSET_COUNT];
+
+#define TEXTURE_DIAL 0
+#define TEXTURE_COUNT 1
+
+extern const vga_texture_t vga_textures[TEXTURE_COUNT];
+
+#endif
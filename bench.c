@@ -0,0 +1,1473 @@
+/**
+ * Benchmarks that run on the Pico, see bench.h
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "gfx.h"
+#include "affine.h"
+#include "scale.h"
+#include "effect.h"
+#include "rgb.h"
+#include "gradient.h"
+#include "flood.h"
+#include "comp.h"
+#include "cursor.h"
+#include "wm.h"
+#include "arena.h"
+#include "shared.h"
+#include "r3d.h"
+#include "svga.h"
+#include "assets.h"
+#include "term.h"
+#include "term_logs.h"
+#include "bench.h"
+
+// Bounds of what the startup code copies from flash to RAM, which includes
+// the drawing code with VGA_RAM_FUNCS
+extern char __data_start__[], __data_end__[];
+
+// XIP cache accesses and misses. The cache counts from boot, so tests take
+// the difference of two readings and nested counts don't disturb each other.
+typedef struct
+{
+    uint32_t accesses;
+    uint32_t misses;
+} xip_counts_t;
+
+static xip_counts_t xip_counts()
+{
+    uint32_t accesses = xip_ctrl_hw->ctr_acc;
+    return (xip_counts_t){accesses, accesses - xip_ctrl_hw->ctr_hit};
+}
+
+static xip_counts_t xip_since(xip_counts_t start)
+{
+    xip_counts_t now = xip_counts();
+    return (xip_counts_t){now.accesses - start.accesses, now.misses - start.misses};
+}
+
+// Feed the recorded logs through the terminal the way term_run() would
+static void bench_term()
+{
+    printf("terminal, %d x %d cells\n", TERM_COLS, TERM_ROWS);
+
+    for (int i = 0; i < TERM_LOG_COUNT; i++)
+    {
+        const term_log_t *log = &term_logs[i];
+
+        term_init(NULL);
+        xip_counts_t xip = xip_counts();
+        uint64_t start = time_us_64();
+        for (uint32_t pos = 0; pos < log->length; pos += TERM_CHUNK)
+        {
+            uint32_t n = log->length - pos;
+            term_write(log->data + pos, n < TERM_CHUNK ? n : TERM_CHUNK);
+        }
+        uint32_t us = time_us_64() - start;
+        uint32_t misses = xip_since(xip).misses;
+
+        uint32_t rate = (uint64_t)log->length * 1000000 / (us ? us : 1);
+        printf("  %-10s %6lu bytes %7lu us %8lu bytes/s, %lu%% of USB full speed, %lu xip misses\n", log->name,
+               (unsigned long)log->length, (unsigned long)us, (unsigned long)rate,
+               (unsigned long)((uint64_t)rate * 100 / BENCH_USB_BYTES_PER_S), (unsigned long)misses);
+    }
+}
+
+// Time spent on each drawing test
+#define DRAW_US 200000
+
+// Core 1 inverts the whole framebuffer over and over, a load that hits every
+// SRAM bank the scan-out DMA reads from
+static void core1_load()
+{
+    while (true)
+    {
+        for (int y = 0; y < VGA_HEIGHT; y++)
+        {
+            uint32_t *row = vga_row(y);
+            for (int i = 0; i < VGA_LINE_WORDS; i++)
+                row[i] ^= VGA_WORD_MASK;
+        }
+    }
+}
+
+// Pixels per second of 100x100 rectangles, characters and 40x40 blits
+static void draw_rates(uint32_t *fill, uint32_t *chars, uint32_t *blits)
+{
+    uint32_t pixels = 0, n = 0;
+    uint64_t start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        fillRect((n * 37) % 540, (n * 23) % 380, 100, 100, n);
+        pixels += 100 * 100;
+        n++;
+    }
+    *fill = (uint64_t)pixels * 1000000 / DRAW_US;
+
+    n = 0;
+    start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        for (int i = 0; i < 100; i++)
+            drawChar((n + i) % 106 * 6, (n + i) / 106 % 60 * 8, 'A' + i % 26, n + i, 0);
+        n += 100;
+    }
+    *chars = (uint64_t)n * 1000000 / DRAW_US;
+
+    n = 0;
+    start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        blitSurface(&vga_assets[ASSET_PALETTE], 0, 0, 40, 40, (n * 41) % 600, (n * 29) % 440);
+        n++;
+    }
+    *blits = (uint64_t)n * 40 * 40 * 1000000 / DRAW_US;
+}
+
+// Drawing speed and scan-out underruns with and without a second core
+// loading the SRAM, with and without DMA bus priority
+static void bench_draw()
+{
+    uint32_t priority = bus_ctrl_hw->priority;
+
+    printf("drawing, %s framebuffer at %p\n",
+#ifdef VGA_BANKED_SRAM
+           "banked",
+#else
+           "striped",
+#endif
+           (void *)vga_data_array);
+    printf("  dma priority  core 1  fill px/s  chars/s  blit px/s  underruns  xip accesses  xip misses\n");
+
+    for (int i = 0; i < 4; i++)
+    {
+        bool dma_priority = i & 1;
+        bool load = i & 2;
+
+        bus_ctrl_hw->priority = dma_priority ? BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS : 0;
+        if (load)
+            multicore_launch_core1(core1_load);
+
+        uint32_t fill, chars, blits;
+        uint32_t before = vga_underruns();
+        xip_counts_t xip = xip_counts();
+        draw_rates(&fill, &chars, &blits);
+        xip = xip_since(xip);
+        uint32_t lost = vga_underruns() - before;
+
+        if (load)
+            multicore_reset_core1();
+        printf("  %-12s  %-6s  %9lu  %7lu  %9lu  %9lu  %12lu  %10lu\n", dma_priority ? "on" : "off",
+               load ? "busy" : "idle", (unsigned long)fill, (unsigned long)chars, (unsigned long)blits,
+               (unsigned long)lost, (unsigned long)xip.accesses, (unsigned long)xip.misses);
+    }
+
+    bus_ctrl_hw->priority = priority;
+}
+
+// Pixel x of row y of a surface
+static int surface_pixel(const vga_surface_t *s, int x, int y)
+{
+    return (surfaceRow(s, y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK;
+}
+
+// What blitSurfaceKeyed() does, one pixel at a time
+static void blit_keyed_reference(const vga_surface_t *src, int sx, int sy, int w, int h, int dx, int dy, char key)
+{
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+        {
+            int c = surface_pixel(src, sx + x, sy + y);
+            if (c != key)
+                drawPixel(dx + x, dy + y, c);
+        }
+}
+
+// Screen pixel (x, y)
+static int screen_pixel(int x, int y)
+{
+    return (vga_row(y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK;
+}
+
+// Draw the keyed palette image at every source and screen alignment, once
+// with blitSurfaceKeyed() at x and once with the reference at x + 320, and
+// compare the two including a word of background on either side. The key
+// color changes with every test so all 64 get used.
+static void check_keyed(int *passed, int *failed)
+{
+    static const int widths[] = {1, 4, 6, 11, 24};
+    const vga_surface_t *src = &vga_assets[ASSET_PALETTE];
+    int test = 0;
+
+    *passed = *failed = 0;
+    for (int sx = 0; sx < 5; sx++)
+        for (int dx = 0; dx < 5; dx++)
+            for (unsigned i = 0; i < count_of(widths); i++, test++)
+            {
+                int w = widths[i], h = 8;
+                int x = 10 + dx, y = 10 + (test % 40) * 10;
+                char key = test & VGA_PIXEL_MASK;
+
+                for (int row = y; row < y + h; row++)
+                    for (int col = x - 5; col < x + w + 5; col++)
+                    {
+                        drawPixel(col, row, col * 7 + row);
+                        drawPixel(col + 320, row, col * 7 + row);
+                    }
+
+                blitSurfaceKeyed(src, sx + 3 * (int)i, 4 * (int)i, w, h, x, y, key);
+                blit_keyed_reference(src, sx + 3 * (int)i, 4 * (int)i, w, h, x + 320, y, key);
+
+                bool same = true;
+                for (int row = y; row < y + h; row++)
+                    for (int col = x - 5; col < x + w + 5; col++)
+                        same &= screen_pixel(col, row) == screen_pixel(col + 320, row);
+                if (same)
+                    ++*passed;
+                else
+                    ++*failed;
+            }
+}
+
+// Correctness and pixels per second of color-keyed blits against the per
+// pixel reference, for the target image (key black) and the palette image
+// (key one of 64 colors)
+static void bench_keyed()
+{
+    int passed, failed;
+    check_keyed(&passed, &failed);
+    printf("keyed blits, %d alignment checks passed, %d failed\n", passed, failed);
+    printf("  image     size   swar px/s  per pixel px/s\n");
+
+    static const int images[] = {ASSET_TARGET, ASSET_PALETTE};
+    for (unsigned i = 0; i < count_of(images); i++)
+    {
+        const vga_surface_t *src = &vga_assets[images[i]];
+        int w = src->width, h = src->height;
+        uint32_t rate[2];
+
+        for (int swar = 0; swar < 2; swar++)
+        {
+            uint32_t n = 0;
+            uint64_t start = time_us_64();
+            while (time_us_64() - start < DRAW_US)
+            {
+                int x = (n * 41) % (VGA_WIDTH - w), y = (n * 29) % (VGA_HEIGHT - h);
+                if (swar)
+                    blitSurfaceKeyed(src, 0, 0, w, h, x, y, 0);
+                else
+                    blit_keyed_reference(src, 0, 0, w, h, x, y, 0);
+                n++;
+            }
+            rate[swar] = (uint64_t)n * w * h * 1000000 / DRAW_US;
+        }
+        printf("  %-8s  %2dx%-2d  %10lu  %14lu\n", images[i] == ASSET_TARGET ? "target" : "palette", w, h,
+               (unsigned long)rate[1], (unsigned long)rate[0]);
+    }
+}
+
+// Full screen passes of each effect test
+#define EFFECT_ROUNDS 20
+
+// Core 1 applies the effect it is sent to the bottom half of the screen and
+// reports back when done
+static void core1_effect()
+{
+    int effect = multicore_fifo_pop_blocking();
+    for (int i = 0; i < EFFECT_ROUNDS; i++)
+        effectRect(0, VGA_HEIGHT / 2, VGA_WIDTH, VGA_HEIGHT / 2, effect, 1);
+    multicore_fifo_push_blocking(0);
+    while (true)
+        tight_loop_contents();
+}
+
+// Framebuffer words per system clock cycle of every effect over the whole
+// screen, on core 0 alone and split between both cores
+static void bench_effects()
+{
+    static const char *names[EFFECT_COUNT] = {"darken", "lighten", "add", "subtract", "blend", "mask"};
+    uint32_t words = EFFECT_ROUNDS * VGA_LINE_WORDS * VGA_HEIGHT;
+    float cycles_per_us = clock_get_hz(clk_sys) / 1e6f;
+
+    printf("effects, words per cycle\n");
+    printf("  effect    1 core  2 cores\n");
+
+    for (int effect = 0; effect < EFFECT_COUNT; effect++)
+    {
+        uint64_t start = time_us_64();
+        for (int i = 0; i < EFFECT_ROUNDS; i++)
+            effectRect(0, 0, VGA_WIDTH, VGA_HEIGHT, effect, 1);
+        uint64_t one = time_us_64() - start;
+
+        multicore_launch_core1(core1_effect);
+        start = time_us_64();
+        multicore_fifo_push_blocking(effect);
+        for (int i = 0; i < EFFECT_ROUNDS; i++)
+            effectRect(0, 0, VGA_WIDTH, VGA_HEIGHT / 2, effect, 1);
+        multicore_fifo_pop_blocking();
+        uint64_t two = time_us_64() - start;
+        multicore_reset_core1();
+
+        printf("  %-8s  %6.3f  %7.3f\n", names[effect], words / (one * cycles_per_us),
+               words / (two * cycles_per_us));
+    }
+}
+
+// Width of the strips the RGB test image is converted in, to keep the rows
+// and the error buffer on the stack
+#define RGB_STRIP 160
+
+// Row y of strip s of the RGB test image: red across, green down, blue
+// across the other way
+static void rgb_test_row(int s, int y, uint8_t *rgb)
+{
+    for (int i = 0; i < RGB_STRIP; i++)
+    {
+        int x = s * RGB_STRIP + i;
+        rgb[3 * i] = x * 255 / (VGA_WIDTH - 1);
+        rgb[3 * i + 1] = y * 255 / (VGA_HEIGHT - 1);
+        rgb[3 * i + 2] = 255 - rgb[3 * i];
+    }
+}
+
+// Microseconds to convert the RGB test image to the screen with a dither
+// mode, or only to generate it with -1
+static uint64_t rgb_image(int dither)
+{
+    uint8_t rgb[3 * RGB_STRIP];
+    int16_t errors[RGB_ERRORS(RGB_STRIP)];
+    uint64_t start = time_us_64();
+
+    for (int s = 0; s < VGA_WIDTH / RGB_STRIP; s++)
+    {
+        memset(errors, 0, sizeof(errors));
+        for (int y = 0; y < VGA_HEIGHT; y++)
+        {
+            rgb_test_row(s, y, rgb);
+            if (dither >= 0)
+                rgb_convert_row(rgb, RGB_STRIP, s * RGB_STRIP, y, dither, errors,
+                                vga_row(y) + s * RGB_STRIP / VGA_PIXELS_PER_WORD);
+        }
+    }
+    return time_us_64() - start;
+}
+
+// Mpixel/s converting a full screen 24-bit image with each dither mode, not
+// counting the time to generate the image
+static void bench_rgb()
+{
+    static const char *names[] = {"none", "ordered", "diffuse"};
+    uint64_t generate = rgb_image(-1);
+
+    printf("rgb888 conversion of %dx%d, Mpixel/s\n", VGA_WIDTH, VGA_HEIGHT);
+    for (int dither = RGB_DITHER_NONE; dither <= RGB_DITHER_DIFFUSE; dither++)
+    {
+        uint64_t us = rgb_image(dither) - generate;
+        printf("  %-8s  %6.2f\n", names[dither], (float)VGA_WIDTH * VGA_HEIGHT / us);
+    }
+}
+
+// The obvious dithered gradient: the position of every pixel in floating
+// point, each channel interpolated and dithered on its own, drawPixel()
+static void gradient_reference(int x, int y, int w, int h, int x0, int y0, char c0, int x1, int y1, char c1,
+                               bool radial)
+{
+    int a[3] = {VGA_RED(c0), VGA_GREEN(c0), VGA_BLUE(c0)};
+    int b[3] = {VGA_RED(c1), VGA_GREEN(c1), VGA_BLUE(c1)};
+    float vx = x1 - x0, vy = y1 - y0;
+    float len2 = vx * vx + vy * vy;
+
+    for (int py = y; py < y + h; py++)
+        for (int px = x; px < x + w; px++)
+        {
+            float t = radial ? sqrtf((px - x0) * (px - x0) + (py - y0) * (py - y0)) / sqrtf(len2)
+                             : ((px - x0) * vx + (py - y0) * vy) / len2;
+            t = t < 0 ? 0 : t > 1 ? 1 : t;
+            float d = (gradient_bayer[py & 7][px & 7] + 0.5f) / 64;
+            int v[3];
+            for (int c = 0; c < 3; c++)
+                v[c] = a[c] + (b[c] - a[c]) * t + d;
+            drawPixel(px, py, VGA_RGB(v[0], v[1], v[2]));
+        }
+}
+
+// Pixels per second of 320x240 gradients, fast and per pixel, and of 8x8
+// pattern fills against solid fills
+static void bench_fills()
+{
+    static const char *names[] = {"vertical", "diagonal", "radial"};
+    int w = VGA_WIDTH / 2, h = VGA_HEIGHT / 2;
+
+    printf("fills of %dx%d, px/s\n", w, h);
+    printf("  gradient      fast  per pixel\n");
+    for (int kind = 0; kind < 3; kind++)
+    {
+        // End point relative to the corner, for the radial one at radius h
+        int ex = kind == 0 ? 0 : kind == 1 ? w : h;
+        int ey = kind == 2 ? 0 : h;
+        uint32_t rate[2];
+
+        for (int fast = 0; fast < 2; fast++)
+        {
+            uint32_t n = 0;
+            uint64_t start = time_us_64();
+            while (time_us_64() - start < DRAW_US)
+            {
+                int x = n % 2 * w, y = n / 2 % 2 * h;
+                char c0 = VGA_RGB(0, 0, 3), c1 = VGA_RGB(3, n % 4, 0);
+                if (!fast)
+                    gradient_reference(x, y, w, h, x, y, c0, x + ex, y + ey, c1, kind == 2);
+                else if (kind == 2)
+                    fillRadialGradient(x, y, w, h, x, y, h, c0, c1);
+                else
+                    fillLinearGradient(x, y, w, h, x, y, c0, x + ex, y + ey, c1);
+                n++;
+            }
+            rate[fast] = (uint64_t)n * w * h * 1000000 / DRAW_US;
+        }
+        printf("  %-8s  %9lu  %9lu\n", names[kind], (unsigned long)rate[1], (unsigned long)rate[0]);
+    }
+
+    static const uint8_t checks[8] = {0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55};
+    vga_pattern_t pattern;
+    makeStipple(&pattern, checks, VGA_RGB(3, 3, 3), VGA_RGB(0, 0, 1));
+    uint32_t rate[2];
+    for (int solid = 0; solid < 2; solid++)
+    {
+        uint32_t n = 0;
+        uint64_t start = time_us_64();
+        while (time_us_64() - start < DRAW_US)
+        {
+            int x = n % 2 * w + n % 5, y = n / 2 % 2 * h;
+            if (solid)
+                fillRect(x, y, w - 5, h, n);
+            else
+                fillRectPattern(x, y, w - 5, h, &pattern);
+            n++;
+        }
+        rate[solid] = (uint64_t)n * (w - 5) * h * 1000000 / DRAW_US;
+    }
+    printf("  pattern %lu px/s, solid %lu px/s\n", (unsigned long)rate[0], (unsigned long)rate[1]);
+}
+
+// Pixels of a color on the screen
+static uint32_t count_color(char color)
+{
+    uint32_t n = 0;
+    for (int y = 0; y < VGA_HEIGHT; y++)
+        for (int x = 0; x < VGA_WIDTH; x++)
+            n += ((vga_row(y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK) == (uint32_t)color;
+    return n;
+}
+
+// Flood fill speed and passes with small and large stacks, on the empty
+// screen and on random walls that break the area into short runs
+static void bench_flood()
+{
+    static const int stacks[] = {64, 1024};
+    uint8_t stack[1024];
+
+    printf("flood fill\n");
+    printf("  screen      stack  passes  pixels  px/s\n");
+    for (int fragmented = 0; fragmented < 2; fragmented++)
+        for (unsigned i = 0; i < count_of(stacks); i++)
+        {
+            fillRect(0, 0, VGA_WIDTH, VGA_HEIGHT, 0);
+            if (fragmented)
+            {
+                // About a third of the pixels become walls
+                uint32_t seed = 1;
+                for (int y = 0; y < VGA_HEIGHT; y++)
+                    for (int x = 0; x < VGA_WIDTH; x++)
+                    {
+                        seed = seed * 1664525 + 1013904223;
+                        if ((seed >> 24) < 85)
+                            drawPixel(x, y, VGA_RGB(1, 1, 1));
+                    }
+                drawPixel(0, 0, 0);
+            }
+
+            uint64_t start = time_us_64();
+            int passes = floodFill(0, 0, VGA_RGB(0, 2, 3), stack, stacks[i]);
+            uint64_t us = time_us_64() - start;
+            uint32_t pixels = count_color(VGA_RGB(0, 2, 3));
+            printf("  %-10s  %5d  %6d  %6lu  %lu\n", fragmented ? "fragmented" : "empty", stacks[i], passes,
+                   (unsigned long)pixels, (unsigned long)((uint64_t)pixels * 1000000 / us));
+        }
+}
+
+// System clocks per scan-out line: sync.pio makes lines of 799 clocks at a
+// fifth of the system clock, 31289 lines/s at 125 MHz
+#define COMP_LINE_CLOCKS (5 * 799)
+
+static uint32_t compose_rate(const comp_layer_t *layers, int count, uint32_t *cover)
+{
+    uint32_t row[VGA_LINE_WORDS];
+    uint32_t n = 0;
+    uint64_t start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+        comp_compose_line(layers, count, n++ % VGA_HEIGHT, row, cover);
+    return (uint64_t)n * 1000000 / DRAW_US;
+}
+
+// Lines per second core 1 composes from 2, 3 and 4 layers, each of which
+// crosses every line, without and with collision flags, then how many lines
+// come late in a second of live compositing. The bottom layer is the
+// framebuffer, above it copies of the framebuffer shifted and keyed on
+// black, so every layer spans the screen.
+static void bench_comp()
+{
+    static const vga_surface_t screen = {vga_data_array, VGA_WIDTH, VGA_HEIGHT, VGA_LINE_WORDS};
+    comp_layer_t layers[COMP_MAX_LAYERS], colliding[COMP_MAX_LAYERS];
+
+    for (int i = 0; i < COMP_MAX_LAYERS; i++)
+    {
+        layers[i] = (comp_layer_t){&screen, i * 37, i * 23, 0, 0, VGA_WIDTH, VGA_HEIGHT, 0, i > 0, true, false, -1};
+        colliding[i] = layers[i];
+        colliding[i].collide = i > 0;
+        colliding[i].hit_color = i > 0 ? VGA_RGB(3, 3, 3) : -1;
+    }
+
+    uint32_t *cover = malloc(COMP_COVER_WORDS * sizeof(uint32_t));
+    if (!cover)
+    {
+        printf("compositor, out of memory\n");
+        return;
+    }
+    printf("compositor, %lu lines/s needed\n", (unsigned long)(clock_get_hz(clk_sys) / COMP_LINE_CLOCKS));
+    printf("  layers  lines/s  with collisions\n");
+    for (int count = 2; count <= COMP_MAX_LAYERS; count++)
+        printf("  %6d  %7lu  %15lu\n", count, (unsigned long)compose_rate(layers, count, cover),
+               (unsigned long)compose_rate(colliding, count, cover));
+    free(cover);
+
+    comp_set_layers(colliding, COMP_MAX_LAYERS);
+    if (!comp_start())
+    {
+        printf("  can't start, out of memory\n");
+        return;
+    }
+    uint32_t late = comp_late_lines();
+    sleep_ms(1000);
+    late = comp_late_lines() - late;
+    uint32_t hits = comp_collisions();
+    comp_stop();
+    printf("  %d layers live for 1 s, %lu late lines, collisions %05lx\n", COMP_MAX_LAYERS, (unsigned long)late,
+           (unsigned long)hits);
+}
+
+// Frames of each cursor test, a second
+#define CURSOR_FRAMES 60
+
+static uint32_t framebuffer_sum()
+{
+    uint32_t sum = 0;
+    for (int i = 0; i < TXCOUNT; i++)
+        sum = (sum << 1 | sum >> 31) ^ vga_data_array[i];
+    return sum;
+}
+
+// Loop iterations core 0 gets through in CURSOR_FRAMES frames, moving the
+// cursor along a circle every frame when it is shown
+static uint32_t cursor_spin(bool shown)
+{
+    uint32_t n = 0;
+    cursor_set_image(shown ? &cursor_arrow : NULL);
+    vga_wait_vblank();
+    uint32_t end = vga_frame_count() + CURSOR_FRAMES;
+    uint32_t frame = vga_frame_count();
+    while ((int32_t)(vga_frame_count() - end) < 0)
+    {
+        if (vga_frame_count() != frame)
+        {
+            frame = vga_frame_count();
+            float a = frame * 0.1f;
+            cursor_move(VGA_WIDTH / 2 + 200 * cosf(a), VGA_HEIGHT / 2 + 200 * sinf(a));
+        }
+        n++;
+    }
+    return n;
+}
+
+// What merging the cursor in the scan-out interrupt costs core 0, whether
+// scan-out kept up, and that the framebuffer was left alone
+static void bench_cursor()
+{
+    uint32_t sum = framebuffer_sum();
+    uint32_t before = vga_underruns();
+    uint32_t hidden = cursor_spin(false);
+    uint32_t shown = cursor_spin(true);
+    uint32_t lost = vga_underruns() - before;
+    cursor_set_image(NULL);
+
+    printf("cursor, %dx%d arrow moving every frame\n", cursor_arrow.surface.width, cursor_arrow.surface.height);
+    printf("  core 0 time left %lu.%lu%%, %lu underruns, framebuffer %s\n",
+           (unsigned long)((uint64_t)shown * 100 / hidden), (unsigned long)((uint64_t)shown * 1000 / hidden % 10),
+           (unsigned long)lost, framebuffer_sum() == sum ? "untouched" : "changed");
+}
+
+// A panel with a title bar in the color it is passed, drawn only inside the
+// clip rectangle as wm.h requires
+static void panel_paint(int x, int y, const wm_rect_t *clip, void *ctx)
+{
+    int title = y + 12 - clip->y;
+    if (title > clip->h)
+        title = clip->h;
+    if (title > 0)
+        fillRect(clip->x, clip->y, clip->w, title, (char)(intptr_t)ctx);
+    else
+        title = 0;
+    fillRect(clip->x, clip->y + title, clip->w, clip->h - title, VGA_RGB(2, 2, 2));
+}
+
+// Operations per second of f on window id
+static uint32_t window_rate(void (*f)(int id, int n), int id)
+{
+    uint32_t n = 0;
+    uint64_t start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+        f(id, n++);
+    return (uint64_t)n * 1000000 / DRAW_US;
+}
+
+// Back and forth along a diagonal, a few pixels at a time like a drag
+static void window_drag(int id, int n)
+{
+    int step = n % 80 < 40 ? n % 40 : 40 - n % 40;
+    wm_move(id, 100 + step * 4, 80 + step * 3);
+}
+
+static void window_raise(int id, int n)
+{
+    wm_raise(id + n % 6);
+}
+
+static void window_repaint(int id, int n)
+{
+    wm_repaint(0, 0, VGA_WIDTH, VGA_HEIGHT);
+}
+
+// Six overlapping 200x150 panels. Dragging the top and the bottom one,
+// raising each in turn and redrawing the whole screen, in operations per
+// second.
+static void bench_windows()
+{
+    wm_init(VGA_RGB(0, 1, 1));
+    int first = -1;
+    for (int i = 0; i < 6; i++)
+    {
+        int id = wm_open(60 + i * 60, 40 + i * 50, 200, 150, panel_paint, (void *)(intptr_t)VGA_RGB(i % 4, 1, 3 - i % 4));
+        if (first < 0)
+            first = id;
+    }
+
+    printf("windows, 6 panels of 200x150\n");
+    printf("  drag top     %6lu moves/s\n", (unsigned long)window_rate(window_drag, first + 5));
+    wm_raise(first);
+    printf("  drag bottom  %6lu moves/s\n", (unsigned long)window_rate(window_drag, first + 1));
+    printf("  raise        %6lu raises/s\n", (unsigned long)window_rate(window_raise, first));
+    printf("  full repaint %6lu repaints/s\n", (unsigned long)window_rate(window_repaint, first));
+    printf("  %lu areas drawn bottom to top\n", (unsigned long)wm_overflows());
+}
+
+// Sprites taken and given back in each round of the allocator test, small
+// enough for the heap in the RAM left next to the banked framebuffer
+#define ARENA_SPRITES 4
+
+// Surfaces per second taken from and given back to a pool of 32x32 sprites
+// against malloc() and free(), and 40x40 surfaces from scratch. The arena is
+// the bottom quarter of the framebuffer, which is scribbled over.
+static void bench_arena()
+{
+    arena_t arena;
+    arena_pool_t pool;
+    arena_scratch_t scratch;
+    vga_surface_t sprites[ARENA_SPRITES];
+    void *blocks[ARENA_SPRITES];
+    int words = ARENA_SURFACE_WORDS(32, 32);
+
+    arena_init(&arena, &vga_data_array[VGA_LINE_WORDS * VGA_HEIGHT * 3 / 4], VGA_LINE_WORDS * VGA_HEIGHT / 4);
+    arena_pool_init(&pool, &arena, words, 16);
+    arena_scratch_init(&scratch, &arena, 8 * ARENA_SURFACE_WORDS(40, 40));
+
+    // Taken in order, given back even ones first
+    uint32_t n = 0;
+    uint64_t start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        for (int i = 0; i < ARENA_SPRITES; i++)
+            arena_pool_surface(&pool, &sprites[i], 32, 32);
+        for (int i = 0; i < ARENA_SPRITES; i++)
+            arena_surface_free(&pool, &sprites[(i * 2 + i / (ARENA_SPRITES / 2)) % ARENA_SPRITES]);
+        n += ARENA_SPRITES;
+    }
+    uint32_t pooled = (uint64_t)n * 1000000 / DRAW_US;
+
+    uint32_t failed = 0;
+    n = 0;
+    start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        for (int i = 0; i < ARENA_SPRITES; i++)
+            failed += (blocks[i] = malloc(words * sizeof(uint32_t))) == NULL;
+        for (int i = 0; i < ARENA_SPRITES; i++)
+            free(blocks[(i * 2 + i / (ARENA_SPRITES / 2)) % ARENA_SPRITES]);
+        n += ARENA_SPRITES;
+    }
+    uint32_t heap = (uint64_t)n * 1000000 / DRAW_US;
+
+    n = 0;
+    start = time_us_64();
+    while (time_us_64() - start < DRAW_US)
+    {
+        vga_surface_t s;
+        if (!arena_scratch_surface(&scratch, &s, 40, 40))
+            arena_scratch_reset(&scratch);
+        n++;
+    }
+    uint32_t scratched = (uint64_t)n * 1000000 / DRAW_US;
+
+    printf("allocators, surfaces per second\n");
+    printf("  pool 32x32     %8lu, high water %d of %d blocks\n", (unsigned long)pooled, pool.high_water,
+           pool.blocks);
+    printf("  malloc 32x32   %8lu, %lu failed\n", (unsigned long)heap, (unsigned long)failed);
+    printf("  scratch 40x40  %8lu, high water %d of %d words\n", (unsigned long)scratched, scratch.high_water,
+           scratch.words);
+}
+
+// Rows and rounds of the dual core drawing test
+#define SHARED_ROWS 96
+#define SHARED_ROUNDS 10
+
+// Ways to split the test between the cores, and whether to lock
+#define SHARED_COLUMNS 0 // every other column, so the cores share every word
+#define SHARED_HALVES 1  // the top and bottom half of the rows
+#define SHARED_LOCKED 2
+
+static inline bool shared_owner(int core, int x, int y, int split)
+{
+    return (split == SHARED_COLUMNS ? x & 1 : y >= SHARED_ROWS / 2) == core;
+}
+
+// Draw the pixels a core owns SHARED_ROUNDS times in changing colors. The
+// last round leaves pixels of core 0 in color SHARED_ROUNDS - 1 and those of
+// core 1 in SHARED_ROUNDS.
+static void shared_pass(int core, int job)
+{
+    int split = job & ~SHARED_LOCKED;
+    for (int r = 0; r < SHARED_ROUNDS; r++)
+        for (int y = 0; y < SHARED_ROWS; y++)
+            for (int x = 0; x < VGA_WIDTH; x++)
+                if (shared_owner(core, x, y, split))
+                {
+                    if (job & SHARED_LOCKED)
+                        drawPixelShared(x, y, r + core);
+                    else
+                        drawPixel(x, y, r + core);
+                }
+}
+
+static void core1_shared()
+{
+    int job = multicore_fifo_pop_blocking();
+    shared_pass(1, job);
+    multicore_fifo_push_blocking(0);
+    while (true)
+        tight_loop_contents();
+}
+
+// Pixels that don't have the color of the last write to them
+static uint32_t shared_lost(int split)
+{
+    uint32_t lost = 0;
+    for (int y = 0; y < SHARED_ROWS; y++)
+        for (int x = 0; x < VGA_WIDTH; x++)
+        {
+            int core = shared_owner(1, x, y, split);
+            lost += ((vga_row(y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK) != SHARED_ROUNDS - 1u + core;
+        }
+    return lost;
+}
+
+// Pixel rate of one core drawing everything, or both drawing their part,
+// and the writes lost without and with the locks. Sharing every word shows
+// the races; the halves show the throughput with little contention.
+static void bench_shared()
+{
+    static const char *names[] = {"1 core", "1 core locked", "2 cores same words", "2 cores same words locked",
+                                  "2 cores own rows locked"};
+    static const int jobs[] = {SHARED_COLUMNS, SHARED_COLUMNS | SHARED_LOCKED, SHARED_COLUMNS,
+                               SHARED_COLUMNS | SHARED_LOCKED, SHARED_HALVES | SHARED_LOCKED};
+    uint32_t pixels = SHARED_ROUNDS * SHARED_ROWS * VGA_WIDTH;
+
+    shared_init();
+    printf("drawing from both cores, %lu pixels\n", (unsigned long)pixels);
+    printf("  test                       pixels/s  lost\n");
+    for (unsigned i = 0; i < count_of(jobs); i++)
+    {
+        bool both = i >= 2;
+        fillRect(0, 0, VGA_WIDTH, SHARED_ROWS, 0);
+
+        uint64_t start = time_us_64();
+        if (both)
+        {
+            multicore_launch_core1(core1_shared);
+            multicore_fifo_push_blocking(jobs[i]);
+            shared_pass(0, jobs[i]);
+            multicore_fifo_pop_blocking();
+            multicore_reset_core1();
+        }
+        else
+        {
+            shared_pass(0, jobs[i]);
+            shared_pass(1, jobs[i]);
+        }
+        uint64_t us = time_us_64() - start;
+
+        printf("  %-25s  %8lu  %lu\n", names[i], (unsigned long)((uint64_t)pixels * 1000000 / us),
+               (unsigned long)shared_lost(jobs[i] & ~SHARED_LOCKED));
+    }
+}
+
+// Frames of each affine test
+#define AFFINE_FRAMES 20
+
+// Rotation and zoom around the texture center for frame f, centered in a
+// w x h rectangle
+static void rotozoom_matrix(int f, int w, int h, int32_t m[6])
+{
+    float angle = f * 0.05f;
+    float zoom = 0.5f + 0.4f * sinf(f * 0.11f);
+    int32_t c = cosf(angle) * zoom * AFFINE_ONE;
+    int32_t s = sinf(angle) * zoom * AFFINE_ONE;
+
+    m[0] = c;
+    m[1] = -s;
+    m[2] = s;
+    m[3] = c;
+    m[4] = 32 * AFFINE_ONE - c * (w / 2) + s * (h / 2);
+    m[5] = 32 * AFFINE_ONE - s * (w / 2) - c * (h / 2);
+}
+
+// A floor seen in perspective below a horizon at the top of the rectangle,
+// scrolling forward by the frame number in ctx
+static void floor_line(int y, affine_line_t *line, void *ctx)
+{
+    int f = *(int *)ctx;
+    int32_t scale = AFFINE_ONE * 16 / (y + 16); // texels per pixel
+
+    line->du = scale;
+    line->dv = 0;
+    line->u = -scale * (VGA_WIDTH / 2);
+    line->v = (int32_t)(AFFINE_ONE * 2048 / (y + 16)) + f * AFFINE_ONE;
+}
+
+static void report_fps(const char *name, uint64_t start)
+{
+    uint32_t us = time_us_64() - start;
+    printf("  %-26s %3lu.%lu fps\n", name, (unsigned long)(AFFINE_FRAMES * 1000000ull / us),
+           (unsigned long)(AFFINE_FRAMES * 10000000ull / us % 10));
+}
+
+// Full screen and quarter screen rotozoom, and a perspective floor with a
+// matrix per line
+static void bench_affine()
+{
+    const vga_texture_t *tex = &vga_textures[TEXTURE_DIAL];
+    int32_t m[6];
+
+    printf("affine blits, %dx%d texture\n", 1 << tex->width_bits, 1 << tex->height_bits);
+
+    uint64_t start = time_us_64();
+    for (int f = 0; f < AFFINE_FRAMES; f++)
+    {
+        rotozoom_matrix(f, VGA_WIDTH, VGA_HEIGHT, m);
+        blitAffine(tex, 0, 0, VGA_WIDTH, VGA_HEIGHT, m);
+    }
+    report_fps("rotozoom 640x480", start);
+
+    start = time_us_64();
+    for (int f = 0; f < AFFINE_FRAMES; f++)
+    {
+        rotozoom_matrix(f, 320, 240, m);
+        blitAffine(tex, 160, 120, 320, 240, m);
+    }
+    report_fps("rotozoom 320x240", start);
+
+    start = time_us_64();
+    for (int f = 0; f < AFFINE_FRAMES; f++)
+        blitAffineLines(tex, 0, 0, VGA_WIDTH, VGA_HEIGHT, floor_line, &f);
+    report_fps("perspective floor 640x480", start);
+}
+
+// Frames of each raycaster test
+#define RAY_FRAMES 10
+
+#define RAY_MAP 16
+
+// Walls around an open middle the camera circles in
+static const char ray_map[RAY_MAP][RAY_MAP + 1] = {
+    "################", "#..............#", "#...######.....#", "#..............#",
+    "#...#......#...#", "#..............#", "#..............#", "#.#..........#.#",
+    "#.#..........#.#", "#..............#", "#..............#", "#...#......#...#",
+    "#..............#", "#.....######...#", "#..............#", "################",
+};
+
+// Ceiling, textured walls and floor of a w x h view at the top left of the
+// screen, one column at a time with a DDA in 16.16 fixed point. Drawn with
+// the column primitives or, for comparison, pixel by pixel.
+static void ray_frame(int f, int w, int h, bool pixels)
+{
+    const vga_texture_t *tex = &vga_textures[TEXTURE_DIAL];
+    const char ceiling = VGA_RGB(0, 0, 1), floor = VGA_RGB(1, 1, 0);
+    float angle = f * 0.05f;
+    int32_t px = (int32_t)((8.0f + 2.0f * cosf(angle)) * AFFINE_ONE);
+    int32_t py = (int32_t)((8.0f + 2.0f * sinf(angle)) * AFFINE_ONE);
+    int32_t dir_x = (int32_t)(-sinf(angle) * AFFINE_ONE), dir_y = (int32_t)(cosf(angle) * AFFINE_ONE);
+    int32_t plane_x = -dir_y * 2 / 3, plane_y = dir_x * 2 / 3;
+
+    for (int c = 0; c < w; c++)
+    {
+        int32_t cam = 2 * c * AFFINE_ONE / w - AFFINE_ONE;
+        int32_t rx = dir_x + (plane_x >> 4) * (cam >> 4) / 256;
+        int32_t ry = dir_y + (plane_y >> 4) * (cam >> 4) / 256;
+        int mx = px >> 16, my = py >> 16;
+        int step_x = rx < 0 ? -1 : 1, step_y = ry < 0 ? -1 : 1;
+        int32_t dx = rx ? 0xffffffffu / (uint32_t)abs(rx) : 0x3fffffff;
+        int32_t dy = ry ? 0xffffffffu / (uint32_t)abs(ry) : 0x3fffffff;
+        dx = dx > 0 && dx < 0x3fffffff ? dx : 0x3fffffff;
+        dy = dy > 0 && dy < 0x3fffffff ? dy : 0x3fffffff;
+        int32_t side_x = ((int64_t)(rx < 0 ? px & 0xffff : AFFINE_ONE - (px & 0xffff)) * dx) >> 16;
+        int32_t side_y = ((int64_t)(ry < 0 ? py & 0xffff : AFFINE_ONE - (py & 0xffff)) * dy) >> 16;
+        bool ns;
+
+        do
+        {
+            ns = side_x >= side_y;
+            if (ns)
+            {
+                side_y += dy;
+                my += step_y;
+            }
+            else
+            {
+                side_x += dx;
+                mx += step_x;
+            }
+        } while (ray_map[my][mx] == '.');
+
+        int32_t dist = ns ? side_y - dy : side_x - dx;
+        if (dist < AFFINE_ONE / 64)
+            dist = AFFINE_ONE / 64;
+        int32_t hit = ns ? px + (int32_t)(((int64_t)dist * rx) >> 16) : py + (int32_t)(((int64_t)dist * ry) >> 16);
+        int u = (hit & 0xffff) >> (16 - tex->width_bits);
+
+        int line = h * AFFINE_ONE / dist;
+        int32_t dv = (AFFINE_ONE << tex->height_bits) / (line ? line : 1);
+        int top = h / 2 - line / 2;
+        int y0 = top < 0 ? 0 : top;
+        int y1 = top + line > h ? h : top + line;
+        int32_t v = (y0 - top) * dv;
+
+        if (pixels)
+        {
+            for (int y = 0; y < h; y++)
+            {
+                char color = y < y0 ? ceiling : y >= y1 ? floor : 0;
+                if (y >= y0 && y < y1)
+                {
+                    color = tex->pixels[(((v >> 16) & ((1 << tex->height_bits) - 1)) << tex->width_bits) + u];
+                    v += dv;
+                }
+                drawPixel(c, y, color);
+            }
+        }
+        else
+        {
+            drawVLine(c, 0, y0, ceiling);
+            drawVLineTextured(c, y0, y1 - y0, tex, u, v, dv);
+            drawVLine(c, y1, h - y1, floor);
+        }
+    }
+}
+
+// Columns and frames per second of the raycaster at two sizes, pixel by
+// pixel against the column primitives
+static void bench_raycast()
+{
+    static const int sizes[][2] = {{320, 240}, {VGA_WIDTH, VGA_HEIGHT}};
+
+    printf("raycaster\n");
+    printf("  view     drawing    columns/s  fps\n");
+    fillRect(0, 0, VGA_WIDTH, VGA_HEIGHT, 0);
+    for (unsigned i = 0; i < count_of(sizes); i++)
+        for (int pixels = 1; pixels >= 0; pixels--)
+        {
+            int w = sizes[i][0], h = sizes[i][1];
+            uint64_t start = time_us_64();
+            for (int f = 0; f < RAY_FRAMES; f++)
+                ray_frame(f, w, h, pixels);
+            uint64_t us = time_us_64() - start;
+
+            printf("  %3dx%-3d  %-9s  %9lu  %3lu.%lu\n", w, h, pixels ? "drawPixel" : "columns",
+                   (unsigned long)((uint64_t)RAY_FRAMES * w * 1000000 / us),
+                   (unsigned long)(RAY_FRAMES * 1000000ull / us), (unsigned long)(RAY_FRAMES * 10000000ull / us % 10));
+        }
+}
+
+// Frames of each 3D test
+#define R3D_FRAMES 60
+
+#define TORUS_MAJOR 12
+#define TORUS_MINOR 8
+
+// The torus mesh, on the heap while the test runs
+typedef struct
+{
+    r3d_vertex_t vertices[TORUS_MAJOR * TORUS_MINOR];
+    uint8_t faces[2 * TORUS_MAJOR * TORUS_MINOR][3];
+    char colors[2 * TORUS_MAJOR * TORUS_MINOR];
+} torus_t;
+
+// A ring of radius 100 around z, 40 thick, checkered in two colors
+static void make_torus(torus_t *t, r3d_mesh_t *mesh)
+{
+    for (int i = 0; i < TORUS_MAJOR; i++)
+        for (int j = 0; j < TORUS_MINOR; j++)
+        {
+            float u = 6.2831853f * i / TORUS_MAJOR, v = 6.2831853f * j / TORUS_MINOR, d = 100 + 40 * cosf(v);
+            int next_i = (i + 1) % TORUS_MAJOR, next_j = (j + 1) % TORUS_MINOR;
+            int a = i * TORUS_MINOR + j, b = next_i * TORUS_MINOR + j;
+            int c = next_i * TORUS_MINOR + next_j, e = i * TORUS_MINOR + next_j;
+
+            t->vertices[a] = (r3d_vertex_t){d * cosf(u), d * sinf(u), 40 * sinf(v)};
+            t->faces[2 * a][0] = a;
+            t->faces[2 * a][1] = b;
+            t->faces[2 * a][2] = c;
+            t->faces[2 * a + 1][0] = a;
+            t->faces[2 * a + 1][1] = c;
+            t->faces[2 * a + 1][2] = e;
+            t->colors[2 * a] = t->colors[2 * a + 1] = (i + j) & 1 ? VGA_RGB(3, 2, 0) : VGA_RGB(0, 2, 3);
+        }
+    *mesh = (r3d_mesh_t){t->vertices, t->faces, t->colors, TORUS_MAJOR * TORUS_MINOR, 2 * TORUS_MAJOR * TORUS_MINOR};
+}
+
+// Triangles and frames per second of a spinning cube and torus, everything
+// on core 0 against transforming on core 0 while core 1 fills
+static void bench_r3d()
+{
+    torus_t *t = malloc(sizeof(torus_t));
+    if (!t)
+    {
+        printf("flat shaded 3D, out of memory\n");
+        return;
+    }
+    r3d_mesh_t torus;
+    make_torus(t, &torus);
+    const struct
+    {
+        const char *name;
+        const r3d_mesh_t *mesh;
+        int distance;
+    } tests[] = {{"cube", &r3d_cube, 400}, {"torus", &torus, 500}};
+
+    printf("flat shaded 3D\n");
+    printf("  mesh   cores  triangles/s  fps    ms/frame\n");
+    for (unsigned i = 0; i < count_of(tests); i++)
+        for (int dual = 0; dual <= 1; dual++)
+        {
+            fillRect(0, 0, VGA_WIDTH, VGA_HEIGHT, 0);
+            if (!r3d_init(VGA_WIDTH / 2, VGA_HEIGHT / 2, 400, 0, dual))
+            {
+                printf("  %-5s  %5d  out of memory\n", tests[i].name, dual + 1);
+                continue;
+            }
+            uint32_t triangles = 0;
+            uint64_t start = time_us_64();
+            for (int f = 0; f < R3D_FRAMES; f++)
+                triangles += r3d_frame(tests[i].mesh, f * 7, f * 11, f * 3, tests[i].distance);
+            r3d_stop();
+            uint64_t us = time_us_64() - start;
+
+            printf("  %-5s  %5d  %11lu  %3lu.%lu  %3lu.%lu\n", tests[i].name, dual + 1,
+                   (unsigned long)((uint64_t)triangles * 1000000 / us), (unsigned long)(R3D_FRAMES * 1000000ull / us),
+                   (unsigned long)(R3D_FRAMES * 10000000ull / us % 10), (unsigned long)(us / R3D_FRAMES / 1000),
+                   (unsigned long)(us / R3D_FRAMES / 100 % 10));
+        }
+    free(t);
+}
+
+// Output pixels per second scaling the 40x40 palette image to integer and
+// non-integer sizes with both filters
+static void bench_scale()
+{
+    static const int sizes[] = {40, 80, 120, 60, 108, 24};
+    const vga_surface_t *src = &vga_assets[ASSET_PALETTE];
+
+    printf("scaled blits from %dx%d\n", src->width, src->height);
+    printf("  size     scale  nearest px/s  average px/s\n");
+
+    for (unsigned i = 0; i < count_of(sizes); i++)
+    {
+        int size = sizes[i];
+        uint32_t rate[2];
+
+        for (int filter = SCALE_NEAREST; filter <= SCALE_AVERAGE; filter++)
+        {
+            uint32_t n = 0;
+            uint64_t start = time_us_64();
+            while (time_us_64() - start < DRAW_US)
+            {
+                blitScaled(src, 0, 0, src->width, src->height, (n * 37) % (VGA_WIDTH - size),
+                           (n * 23) % (VGA_HEIGHT - size), size, size, filter);
+                n++;
+            }
+            rate[filter] = (uint64_t)n * size * size * 1000000 / DRAW_US;
+        }
+        printf("  %3dx%-3d  %2d.%02d  %12lu  %12lu\n", size, size, size / src->width,
+               size * 100 / src->width % 100, (unsigned long)rate[0], (unsigned long)rate[1]);
+    }
+}
+
+// Frames of each workload
+#define WORKLOAD_FRAMES 20
+
+#define PARTICLES 4096
+
+// A smooth loop through the palette, shared by the workloads
+static char workload_palette[64];
+
+// One period of sine over 256 steps, -127 to 127
+static int8_t workload_sine[256];
+
+// A full screen workload. frame() draws the share of frame f that falls to
+// core out of cores: every cores-th row, starting at row core, or every
+// cores-th particle.
+typedef struct
+{
+    const char *name;
+    void (*frame)(int core, int cores, int f);
+} workload_t;
+
+static const workload_t *workload;
+
+// Fixed point Mandelbrot set in 20.12, zooming in on a spiral
+static void mandelbrot_frame(int core, int cores, int f)
+{
+    const int32_t cx = -3046, cy = 540; // -0.7437, 0.1318
+    int32_t step = 3.0f / VGA_WIDTH * 65536 * powf(0.92f, f); // 16.16, shifted down to 20.12 per pixel
+
+    for (int y = core; y < VGA_HEIGHT; y += cores)
+    {
+        uint32_t *row = vga_row(y);
+        int32_t ci = cy + ((VGA_HEIGHT / 2 - y) * step >> 4);
+        for (int w = 0; w < VGA_LINE_WORDS; w++)
+        {
+            uint32_t word = 0;
+            for (int i = 0; i < VGA_PIXELS_PER_WORD; i++)
+            {
+                int32_t cr = cx + ((w * VGA_PIXELS_PER_WORD + i - VGA_WIDTH / 2) * step >> 4);
+                int32_t zr = 0, zi = 0;
+                int n = 0;
+                while (n < 48)
+                {
+                    int32_t rr = zr * zr >> 12, ii = zi * zi >> 12;
+                    if (rr + ii > 4 << 12)
+                        break;
+                    zi = (zr * zi >> 11) + ci;
+                    zr = rr - ii + cr;
+                    n++;
+                }
+                word |= (uint32_t)(n == 48 ? 0 : workload_palette[n & 63]) << VGA_PIXEL_SHIFT(i);
+            }
+            row[w] = word;
+        }
+    }
+}
+
+// Four sine waves summed per pixel from a table
+static void plasma_frame(int core, int cores, int f)
+{
+    for (int y = core; y < VGA_HEIGHT; y += cores)
+    {
+        uint32_t *row = vga_row(y);
+        int vy = workload_sine[(y * 2 + f * 3) & 255] + f * 2;
+        for (int w = 0; w < VGA_LINE_WORDS; w++)
+        {
+            uint32_t word = 0;
+            for (int i = 0; i < VGA_PIXELS_PER_WORD; i++)
+            {
+                int x = w * VGA_PIXELS_PER_WORD + i;
+                int v = vy + workload_sine[(x + f * 5) & 255] + workload_sine[(x + y + f * 2) & 255] +
+                        workload_sine[(workload_sine[(x >> 1) & 255] + y + f * 4) & 255];
+                word |= (uint32_t)workload_palette[(v >> 3) & 63] << VGA_PIXEL_SHIFT(i);
+            }
+            row[w] = word;
+        }
+    }
+}
+
+// Where particle i of the fountain is in frame f, in pixels. Positions are
+// worked out from scratch each frame rather than kept, to need no RAM.
+static void particle_at(int i, int f, int *x, int *y)
+{
+    uint32_t h = i * 2654435761u;
+    int life = 64 + (h & 63);
+    int t = (f + (h >> 6)) % life;
+    int vx = (int)((h >> 12) & 127) - 64, vy = 96 + ((h >> 20) & 63); // 1/16 pixel per frame
+
+    *x = VGA_WIDTH / 2 + (vx * t >> 4);
+    *y = VGA_HEIGHT - 20 - ((vy * t - 3 * t * t / 2) >> 4);
+}
+
+// A fountain of particles, each erased where it was and drawn where it is.
+// With two cores the words are shared, so they draw through shared.h.
+static void particles_frame(int core, int cores, int f)
+{
+    void (*pixel)(int x, int y, char color) = cores > 1 ? drawPixelShared : drawPixel;
+
+    for (int i = core; i < PARTICLES; i += cores)
+    {
+        int x, y;
+        particle_at(i, f - 1, &x, &y);
+        if ((unsigned)x < VGA_WIDTH && (unsigned)y < VGA_HEIGHT)
+            pixel(x, y, 0);
+        particle_at(i, f, &x, &y);
+        if ((unsigned)x < VGA_WIDTH && (unsigned)y < VGA_HEIGHT)
+            pixel(x, y, workload_palette[i & 63]);
+    }
+}
+
+#define CHART_TRACES 3
+
+// Value of a chart trace at column c counted from the start
+static int chart_value(int trace, int c)
+{
+    int v = workload_sine[(c * (trace + 1)) & 255] + workload_sine[(c * 7 / (trace + 2) + trace * 85) & 255] / 2;
+    return (trace + 1) * VGA_HEIGHT / (CHART_TRACES + 1) - v * 60 / 127;
+}
+
+// A strip chart scrolling left a word (5 pixels) per frame. Every row moves
+// over and gets its new word from the traces and grid lines.
+static void chart_frame(int core, int cores, int f)
+{
+    static const char colors[CHART_TRACES] = {VGA_RGB(3, 3, 0), VGA_RGB(0, 3, 3), VGA_RGB(3, 1, 3)};
+    int from[CHART_TRACES][VGA_PIXELS_PER_WORD], to[CHART_TRACES][VGA_PIXELS_PER_WORD];
+
+    // The new columns, each a segment from the value in the column before
+    for (int t = 0; t < CHART_TRACES; t++)
+        for (int i = 0; i < VGA_PIXELS_PER_WORD; i++)
+        {
+            int c = f * VGA_PIXELS_PER_WORD + i;
+            int a = chart_value(t, c - 1), b = chart_value(t, c);
+            from[t][i] = a < b ? a : b;
+            to[t][i] = a < b ? b : a;
+        }
+
+    for (int y = core; y < VGA_HEIGHT; y += cores)
+    {
+        uint32_t *row = vga_row(y);
+        memmove(row, row + 1, (VGA_LINE_WORDS - 1) * sizeof(uint32_t));
+
+        uint32_t word = 0;
+        for (int i = 0; i < VGA_PIXELS_PER_WORD; i++)
+        {
+            char color = y % 60 == 0 || (f * VGA_PIXELS_PER_WORD + i) % 80 == 0 ? VGA_RGB(1, 1, 1) : 0;
+            for (int t = 0; t < CHART_TRACES; t++)
+                if (y >= from[t][i] && y <= to[t][i])
+                    color = colors[t];
+            word |= (uint32_t)color << VGA_PIXEL_SHIFT(i);
+        }
+        row[VGA_LINE_WORDS - 1] = word;
+    }
+}
+
+static const workload_t workloads[] = {
+    {"mandelbrot", mandelbrot_frame},
+    {"plasma", plasma_frame},
+    {"particles", particles_frame},
+    {"chart", chart_frame},
+};
+
+// Core 1 draws its share of every frame number it is sent
+static void core1_workload()
+{
+    while (true)
+    {
+        int f = multicore_fifo_pop_blocking();
+        workload->frame(1, 2, f);
+        multicore_fifo_push_blocking(0);
+    }
+}
+
+void bench_workloads()
+{
+    for (int i = 0; i < 64; i++)
+    {
+        // Red, green and blue rise and fall a third of the way apart
+        int r = (i + 0) % 64, g = (i + 21) % 64, b = (i + 43) % 64;
+        r = r < 32 ? r / 8 : (63 - r) / 8;
+        g = g < 32 ? g / 8 : (63 - g) / 8;
+        b = b < 32 ? b / 8 : (63 - b) / 8;
+        workload_palette[i] = VGA_RGB(r, g, b);
+    }
+    for (int i = 0; i < 256; i++)
+        workload_sine[i] = 127 * sinf(i * 6.2831853f / 256);
+    shared_init();
+
+    uint32_t total = vga_underruns();
+    printf("workloads, %d frames each\n", WORKLOAD_FRAMES);
+    printf("  workload    cores  ms/frame min   avg   max  fps    underruns\n");
+    for (unsigned i = 0; i < count_of(workloads); i++)
+        for (int cores = 1; cores <= 2; cores++)
+        {
+            workload = &workloads[i];
+            fillRect(0, 0, VGA_WIDTH, VGA_HEIGHT, 0);
+            if (cores > 1)
+                multicore_launch_core1(core1_workload);
+
+            uint32_t before = vga_underruns();
+            uint32_t shortest = UINT32_MAX, longest = 0;
+            uint64_t start = time_us_64();
+            for (int f = 0; f < WORKLOAD_FRAMES; f++)
+            {
+                uint64_t frame_start = time_us_64();
+                if (cores > 1)
+                    multicore_fifo_push_blocking(f);
+                workload->frame(0, cores, f);
+                if (cores > 1)
+                    multicore_fifo_pop_blocking();
+                uint32_t us = time_us_64() - frame_start;
+                shortest = us < shortest ? us : shortest;
+                longest = us > longest ? us : longest;
+            }
+            uint64_t us = time_us_64() - start;
+            uint32_t lost = vga_underruns() - before;
+
+            if (cores > 1)
+                multicore_reset_core1();
+            printf("  %-10s  %5d  %12lu  %5lu  %4lu  %3lu.%lu  %9lu\n", workload->name, cores,
+                   (unsigned long)(shortest / 1000), (unsigned long)(us / WORKLOAD_FRAMES / 1000),
+                   (unsigned long)(longest / 1000), (unsigned long)(WORKLOAD_FRAMES * 1000000ull / us),
+                   (unsigned long)(WORKLOAD_FRAMES * 10000000ull / us % 10), (unsigned long)lost);
+        }
+    printf("  underruns in all %lu\n", (unsigned long)(vga_underruns() - total));
+    stdio_flush();
+}
+
+// Frames bench_svga() watches
+#define SVGA_CHECK_FRAMES 300
+
+// Pixel clock and whole frame of 800x600, see svga.h
+#define SVGA_PIXEL_HZ 40000000
+#define SVGA_FRAME_PIXELS (1056 * 628)
+
+// A schematic-like test card: a border on the outermost pixels, which shows
+// whether the porches put the picture where the monitor expects it, a dot
+// grid, the palette, and boxes joined by lines
+static void svga_test_card()
+{
+    svga_fill_rect(0, 0, SVGA_WIDTH, SVGA_HEIGHT, 1);
+    for (int y = 10; y < SVGA_HEIGHT; y += 20)
+        for (int x = 10; x < SVGA_WIDTH; x += 20)
+            svga_pixel(x, y, 8);
+    for (int i = 0; i < SVGA_COLORS; i++)
+        svga_fill_rect(40 + i * 45, 30, 40, 30, i);
+    for (int i = 0; i < 6; i++)
+    {
+        int x = 60 + i * 120, y = 120 + (i % 3) * 140;
+        svga_fill_rect(x, y, 80, 1, 15);
+        svga_fill_rect(x, y + 59, 80, 1, 15);
+        svga_fill_rect(x, y, 1, 60, 15);
+        svga_fill_rect(x + 79, y, 1, 60, 15);
+        if (i < 5)
+        {
+            int next_y = 120 + ((i + 1) % 3) * 140;
+            svga_fill_rect(x + 80, y + 30, 20, 1, 14);
+            svga_fill_rect(x + 100, y + 30 < next_y + 30 ? y + 30 : next_y + 30, 1, abs(next_y - y) + 1, 14);
+            svga_fill_rect(x + 100, next_y + 30, 20, 1, 14);
+        }
+    }
+    svga_fill_rect(0, 0, SVGA_WIDTH, 1, 15);
+    svga_fill_rect(0, SVGA_HEIGHT - 1, SVGA_WIDTH, 1, 15);
+    svga_fill_rect(0, 0, 1, SVGA_HEIGHT, 15);
+    svga_fill_rect(SVGA_WIDTH - 1, 0, 1, SVGA_HEIGHT, 15);
+}
+
+void bench_svga()
+{
+    svga_start();
+    svga_test_card();
+
+    // Time whole frames by the lines the DMA finished
+    uint32_t first = svga_lines_sent() / SVGA_HEIGHT + 1;
+    while (svga_lines_sent() < first * SVGA_HEIGHT)
+        tight_loop_contents();
+    uint64_t start = time_us_64();
+    while (svga_lines_sent() < (first + SVGA_CHECK_FRAMES) * SVGA_HEIGHT)
+        tight_loop_contents();
+    uint64_t us = time_us_64() - start;
+
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    uint32_t underruns = svga_underruns(), late = svga_late_lines(), cycles = svga_expand_cycles();
+    svga_stop();
+
+    uint32_t budget = sys_hz / (SVGA_PIXEL_HZ / 1056);
+    uint64_t expected = 1000000000ull * SVGA_PIXEL_HZ / SVGA_FRAME_PIXELS;
+    uint64_t measured = 1000000000ull * SVGA_CHECK_FRAMES / us;
+    printf("svga 800x600, system clock %lu MHz, %d frames\n", (unsigned long)(sys_hz / 1000000), SVGA_CHECK_FRAMES);
+    printf("  frame rate %lu.%03lu Hz, %lu.%03lu expected\n", (unsigned long)(measured / 1000000),
+           (unsigned long)(measured / 1000 % 1000), (unsigned long)(expected / 1000000),
+           (unsigned long)(expected / 1000 % 1000));
+    uint64_t bytes = 4ull * SVGA_LINE_WORDS * SVGA_HEIGHT * SVGA_CHECK_FRAMES;
+    printf("  sent %lu bytes/s\n", (unsigned long)(bytes * 1000000 / us));
+    printf("  core 1 expands a line in %lu of %lu clocks at most\n", (unsigned long)cycles, (unsigned long)budget);
+    printf("  underruns %lu, late lines %lu: %s\n", (unsigned long)underruns, (unsigned long)late,
+           underruns || late ? "falls behind" : "keeps up");
+    stdio_flush();
+}
+
+// Run one test and print the XIP cache traffic of all of it
+static void run(void (*bench)())
+{
+    xip_counts_t xip = xip_counts();
+    bench();
+    xip = xip_since(xip);
+    printf("  xip accesses %lu, misses %lu\n", (unsigned long)xip.accesses, (unsigned long)xip.misses);
+}
+
+void bench_run()
+{
+    printf("vga benchmarks, drawing code in %s, %lu bytes of code and data copied to RAM\n",
+#ifdef VGA_RAM_FUNCS
+           "RAM",
+#else
+           "flash",
+#endif
+           (unsigned long)(__data_end__ - __data_start__));
+    run(bench_draw);
+    run(bench_affine);
+    run(bench_scale);
+    run(bench_raycast);
+    run(bench_r3d);
+    run(bench_keyed);
+    run(bench_effects);
+    run(bench_fills);
+    run(bench_flood);
+    run(bench_rgb);
+    run(bench_comp);
+    run(bench_cursor);
+    run(bench_windows);
+    run(bench_arena);
+    run(bench_shared);
+    run(bench_term);
+    stdio_flush();
+}
@@ -0,0 +1,28 @@
+/**
+ * Benchmarks that run on the Pico
+ *
+ * bench_run() draws on the screen and prints its results to stdio (USB
+ * serial). Send 'b' to the demo firmware to run it. It uses core 1, so it
+ * can't run next to the gpu mode.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// What a USB full speed bulk endpoint can carry: 19 64-byte packets per 1 ms
+// frame. The terminal has to keep up with this to never stall the host.
+#define BENCH_USB_BYTES_PER_S 1216000
+
+void bench_run(void);
+
+// Mandelbrot, plasma, particle and strip chart workloads on one core and
+// split over both, with time per frame and scan-out underruns. Send 'w' to
+// the demo firmware to run them.
+void bench_workloads(void);
+
+// 800x600 with a test card for a few seconds (see svga.h), then the frame
+// rate and whether the DMA, the rgb state machine and core 1 kept up. Send
+// 's' to the demo firmware to run it.
+void bench_svga(void);
+
+#endif
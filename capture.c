@@ -0,0 +1,171 @@
+/**
+ * Framebuffer capture over USB serial, see capture.h for the stream format
+ *
+ * Lines are read through the line table so the capture matches the screen.
+ */
+
+#include "pico/stdlib.h"
+#include "vga.h"
+#include "capture.h"
+
+#define LITERAL_MAX 64
+#define REPEAT_MAX 65
+#define COPY_MAX 128
+
+static uint8_t chunk[CAPTURE_CHUNK];
+static uint32_t chunk_len;
+static uint32_t body_bytes;
+static uint32_t transfer_us;
+
+static void flush_chunk()
+{
+    uint32_t start = time_us_32();
+    for (uint32_t i = 0; i < chunk_len; i++)
+        putchar_raw(chunk[i]);
+    transfer_us += time_us_32() - start;
+    chunk_len = 0;
+}
+
+static void put_byte(uint8_t b)
+{
+    if (chunk_len == CAPTURE_CHUNK)
+        flush_chunk();
+    chunk[chunk_len++] = b;
+}
+
+static void put_u16(uint16_t v)
+{
+    put_byte(v);
+    put_byte(v >> 8);
+}
+
+static void put_u32(uint32_t v)
+{
+    put_u16(v);
+    put_u16(v >> 16);
+}
+
+static void put_literals(const uint32_t *words, int count)
+{
+    while (count > 0)
+    {
+        int n = count > LITERAL_MAX ? LITERAL_MAX : count;
+        put_byte(n - 1);
+        for (int i = 0; i < n; i++)
+            put_u32(words[i]);
+        body_bytes += 1 + 4 * n;
+        words += n;
+        count -= n;
+    }
+}
+
+static void put_repeat(uint32_t word, int count)
+{
+    while (count > 0)
+    {
+        // A repeat token covers at least two words, a lone one is a literal
+        if (count == 1)
+        {
+            put_literals(&word, 1);
+            return;
+        }
+        int n = count > REPEAT_MAX ? REPEAT_MAX : count;
+        put_byte(0x40 + n - 2);
+        put_u32(word);
+        body_bytes += 5;
+        count -= n;
+    }
+}
+
+static void put_copy(int count)
+{
+    // A line is never longer than COPY_MAX words
+    put_byte(0x80 + count - 1);
+    body_bytes++;
+}
+
+// Compress one line. above is NULL for the first line.
+static void encode_line(const uint32_t *line, const uint32_t *above)
+{
+    int literal_start = 0;
+    int i = 0;
+
+    while (i < VGA_LINE_WORDS)
+    {
+        int copy = 0;
+        if (above)
+            while (i + copy < VGA_LINE_WORDS && line[i + copy] == above[i + copy])
+                copy++;
+
+        int repeat = 1;
+        while (i + repeat < VGA_LINE_WORDS && line[i + repeat] == line[i])
+            repeat++;
+
+        // A copy costs one byte for any length, so it wins ties
+        if (copy > 0 && copy >= repeat)
+        {
+            put_literals(&line[literal_start], i - literal_start);
+            put_copy(copy);
+            i += copy;
+            literal_start = i;
+        }
+        else if (repeat >= 2)
+        {
+            put_literals(&line[literal_start], i - literal_start);
+            put_repeat(line[i], repeat);
+            i += repeat;
+            literal_start = i;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    put_literals(&line[literal_start], i - literal_start);
+}
+
+void vga_capture(void)
+{
+    chunk_len = 0;
+    body_bytes = 0;
+    transfer_us = 0;
+
+    vga_wait_vblank();
+    uint32_t start = time_us_32();
+
+    put_byte('V');
+    put_byte('G');
+    put_byte('A');
+    put_byte('C');
+    put_byte(CAPTURE_VERSION);
+    put_byte(CAPTURE_FORMAT_PACKED6);
+    put_u16(VGA_WIDTH);
+    put_u16(VGA_HEIGHT);
+    put_u16(VGA_LINE_WORDS);
+
+    uint32_t sum = 0;
+    for (int y = 0; y < VGA_HEIGHT; y++)
+    {
+        const uint32_t *line = vga_row(y);
+        encode_line(line, y > 0 ? vga_row(y - 1) : NULL);
+        for (int i = 0; i < VGA_LINE_WORDS; i++)
+            sum += line[i];
+    }
+
+    flush_chunk();
+
+    // Everything that is not USB time went into compressing
+    uint32_t encode_us = time_us_32() - start - transfer_us;
+
+    put_byte('V');
+    put_byte('E');
+    put_byte('N');
+    put_byte('D');
+    put_u32(TXCOUNT);
+    put_u32(sum);
+    put_u32(body_bytes);
+    put_u32(encode_us);
+    put_u32(transfer_us);
+    flush_chunk();
+    stdio_flush();
+}
@@ -0,0 +1,33 @@
+/**
+ * Framebuffer capture over USB serial
+ *
+ * vga_capture() waits for the end of the current frame and streams
+ * vga_data_array to stdio, compressed, in the packed 6bpp form. Drawing on the
+ * calling core stops until the transfer is finished, so the image is the
+ * frame that was on screen when the capture started. host/vgacap.cpp turns
+ * the stream into a PPM file.
+ *
+ * STREAM FORMAT (all integers little endian)
+ *  header:  "VGAC", version (u8, 1), pixel format (u8, 0 = packed 6bpp),
+ *           width (u16), height (u16), words per line (u16)
+ *  body:    one token per run, runs never cross a line
+ *           0x00-0x3f  n+1 literal words follow (4 bytes each)
+ *           0x40-0x7f  the following word repeats n-0x40+2 times
+ *           0x80-0xff  copy n-0x80+1 words from the line above
+ *  trailer: "VEND", words (u32), sum of all words (u32), body bytes (u32),
+ *           time spent compressing in us (u32), time spent sending in us (u32)
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#define CAPTURE_VERSION 1
+#define CAPTURE_FORMAT_PACKED6 0
+
+// Size of the staging buffer the compressor fills before each USB write,
+// the size of the USB serial transmit buffer
+#define CAPTURE_CHUNK 256
+
+void vga_capture(void);
+
+#endif
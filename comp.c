@@ -0,0 +1,272 @@
+/**
+ * Scan-out compositor, see comp.h
+ */
+
+#include <stdlib.h>
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "comp.h"
+#include "span.h"
+
+// In SCRATCH_X next to core 1's stack, away from the framebuffer banks
+static uint32_t __scratch_x("comp") lines[COMP_LINES][VGA_LINE_WORDS];
+
+// Taken from the heap while the compositor runs: the scan table, where
+// line y is sent from lines[y % COMP_LINES], and core 1's collision masks
+typedef struct
+{
+    uint32_t *table[VGA_HEIGHT];
+    uint32_t covers[COMP_COVER_WORDS];
+} buffers_t;
+
+static buffers_t *buffers;
+
+// Layers waiting for the next frame. The version is odd while core 0 is
+// writing them.
+static comp_layer_t pending[COMP_MAX_LAYERS];
+static int pending_count;
+static volatile uint32_t pending_version;
+
+static volatile bool stopping;
+static volatile uint32_t late;
+static volatile uint32_t collisions;
+
+// Number (see vga_scan_position()) of the first line sent from the buffers
+static uint32_t first_line;
+
+// The screen rectangle a layer covers, inclusive, and where it starts in
+// its surface. Empty when x0 > x1 or y0 > y1.
+typedef struct
+{
+    int x0, y0, x1, y1;
+} extent_t;
+
+static inline extent_t extent(const comp_layer_t *l)
+{
+    extent_t e = {l->x, l->y, l->x + l->surface->width - 1, l->y + l->surface->height - 1};
+
+    if (e.x0 < l->clip_x)
+        e.x0 = l->clip_x;
+    if (e.y0 < l->clip_y)
+        e.y0 = l->clip_y;
+    if (e.x1 > l->clip_x + l->clip_w - 1)
+        e.x1 = l->clip_x + l->clip_w - 1;
+    if (e.y1 > l->clip_y + l->clip_h - 1)
+        e.y1 = l->clip_y + l->clip_h - 1;
+    if (e.x0 < 0)
+        e.x0 = 0;
+    if (e.y0 < 0)
+        e.y0 = 0;
+    if (e.x1 > VGA_WIDTH - 1)
+        e.x1 = VGA_WIDTH - 1;
+    if (e.y1 > VGA_HEIGHT - 1)
+        e.y1 = VGA_HEIGHT - 1;
+    return e;
+}
+
+// Mask of the pixels of a span in each of its words
+static inline void span_cover(uint32_t *cover, int x0, int x1)
+{
+    int w0 = x0 / 5, w1 = x1 / 5;
+    for (int i = w0; i <= w1; i++)
+        cover[i - w0] = VGA_SPAN_MASK(i == w0 ? x0 % 5 : 0, i == w1 ? x1 % 5 : 4);
+}
+
+// Whether a span, with a mask per word, covers any pixel of color in row
+static inline bool covers_color(const uint32_t *row, int w0, int w1, const uint32_t *cover, uint32_t color)
+{
+    for (int i = w0; i <= w1; i++)
+        if (cover[i - w0] & ~vga_swar_key_mask(row[i], color))
+            return true;
+    return false;
+}
+
+uint32_t __not_in_flash_func(comp_compose_line)(const comp_layer_t *layers, int count, int y, uint32_t *row,
+                                                uint32_t *cover)
+{
+    // Masks of the pixels each layer showed on the line, from the word its
+    // span starts in
+    uint32_t (*covers)[VGA_LINE_WORDS] = (uint32_t (*)[VGA_LINE_WORDS])cover;
+    extent_t e[COMP_MAX_LAYERS];
+    int bottom = count;
+    uint32_t hits = 0;
+
+    // Nothing below an opaque layer that covers the whole line shows
+    for (int i = 0; i < count; i++)
+    {
+        e[i] = extent(&layers[i]);
+        if (!layers[i].enabled || y < e[i].y0 || y > e[i].y1 || e[i].x0 > e[i].x1)
+            e[i].x0 = VGA_WIDTH;
+        else if (!layers[i].keyed && e[i].x0 == 0 && e[i].x1 == VGA_WIDTH - 1)
+            bottom = i;
+    }
+    // The opaque bottom layer has nothing under it to hit
+    int under = bottom + 1;
+    if (bottom == count)
+    {
+        vga_span_fill(row, 0, VGA_WIDTH - 1, 0);
+        bottom = under = 0;
+    }
+
+    for (int i = bottom; i < count; i++)
+    {
+        const comp_layer_t *l = &layers[i];
+        if (e[i].x0 >= VGA_WIDTH)
+            continue;
+
+        const vga_surface_t *s = l->surface;
+        const uint32_t *src = surfaceRow(s, y - l->y);
+        int w = e[i].x1 - e[i].x0 + 1;
+        int w0 = e[i].x0 / 5, w1 = e[i].x1 / 5;
+        bool covered = l->collide || l->hit_color >= 0;
+        uint32_t key = l->key & VGA_PIXEL_MASK;
+
+        // What the layer covers is needed before it is merged for hit_color,
+        // which is then checked against the line under it
+        if (covered && !l->keyed)
+            span_cover(covers[i], e[i].x0, e[i].x1);
+        else if (l->hit_color >= 0)
+            for (int k = w0; k <= w1; k++)
+            {
+                uint32_t value = vga_fetch5(src, s->stride, k * 5 - l->x);
+                uint32_t mask = vga_swar_key_mask(value, key);
+                if (k == w0 || k == w1)
+                    mask &= VGA_SPAN_MASK(k == w0 ? e[i].x0 % 5 : 0, k == w1 ? e[i].x1 % 5 : 4);
+                covers[i][k - w0] = mask;
+            }
+        if (l->hit_color >= 0 && i >= under && covers_color(row, w0, w1, covers[i], l->hit_color & VGA_PIXEL_MASK))
+            hits |= COMP_HIT_COLOR(i);
+
+        if (l->keyed)
+            vga_span_copy_cover(row, e[i].x0, src, s->stride, e[i].x0 - l->x, w, key, covered ? covers[i] : NULL);
+        else
+            vga_span_copy(row, e[i].x0, src, s->stride, e[i].x0 - l->x, w);
+
+        if (!l->collide)
+            continue;
+        for (int j = bottom; j < i; j++)
+        {
+            if (!layers[j].collide || e[j].x0 >= VGA_WIDTH || (hits & COMP_HIT(i, j)))
+                continue;
+            int j0 = e[j].x0 / 5, j1 = e[j].x1 / 5;
+            int lo = w0 > j0 ? w0 : j0, hi = w1 < j1 ? w1 : j1;
+            for (int k = lo; k <= hi; k++)
+                if (covers[i][k - w0] & covers[j][k - j0])
+                {
+                    hits |= COMP_HIT(i, j);
+                    break;
+                }
+        }
+    }
+    return hits;
+}
+
+void comp_set_layers(const comp_layer_t *layers, int count)
+{
+    if (count > COMP_MAX_LAYERS)
+        count = COMP_MAX_LAYERS;
+
+    pending_version++;
+    __dmb();
+    for (int i = 0; i < count; i++)
+        pending[i] = layers[i];
+    pending_count = count;
+    __dmb();
+    pending_version++;
+}
+
+// Copy the pending layers if there is a new complete set
+static void __not_in_flash_func(latch)(comp_layer_t *active, int *count, uint32_t *version)
+{
+    uint32_t v = pending_version;
+    if (v == *version || (v & 1))
+        return;
+
+    __dmb();
+    int n = pending_count;
+    comp_layer_t copy[COMP_MAX_LAYERS];
+    for (int i = 0; i < n; i++)
+        copy[i] = pending[i];
+    __dmb();
+
+    // Core 0 started again meanwhile, try next frame
+    if (pending_version != v)
+        return;
+    for (int i = 0; i < n; i++)
+        active[i] = copy[i];
+    *count = n;
+    *version = v;
+}
+
+static void __not_in_flash_func(core1_main)()
+{
+    comp_layer_t active[COMP_MAX_LAYERS];
+    int count = 0;
+    uint32_t version = 0;
+    uint32_t hits = 0;
+
+    for (uint32_t n = first_line; !stopping; n++)
+    {
+        int y = n % VGA_HEIGHT;
+        if (y == 0)
+            latch(active, &count, &version);
+
+        // Wait for the buffer to be sent COMP_LINES lines ago
+        while ((int32_t)(n - vga_scan_position()) >= COMP_LINES)
+            tight_loop_contents();
+
+        hits |= comp_compose_line(active, count, y, lines[y % COMP_LINES], buffers->covers);
+        if (y == VGA_HEIGHT - 1)
+        {
+            collisions = hits;
+            hits = 0;
+        }
+        if ((int32_t)(vga_scan_position() - n) >= 0)
+            late++;
+    }
+
+    while (true)
+        tight_loop_contents();
+}
+
+bool comp_start(void)
+{
+    buffers = malloc(sizeof(buffers_t));
+    if (!buffers)
+        return false;
+
+    for (int y = 0; y < VGA_HEIGHT; y++)
+        buffers->table[y] = lines[y % COMP_LINES];
+    stopping = false;
+
+    // The scan table takes effect with the frame after the one starting now,
+    // which leaves this frame's time to compose the first lines
+    vga_wait_vblank();
+    vga_set_scan_table(buffers->table);
+    first_line = (vga_frame_count() + 1) * VGA_HEIGHT;
+    multicore_launch_core1(core1_main);
+    return true;
+}
+
+void comp_stop(void)
+{
+    // Core 1 keeps the buffers filled until scan-out has left them, which is
+    // at the latest when the frame after next starts
+    vga_set_scan_table(NULL);
+    vga_wait_vblank();
+    vga_wait_vblank();
+    stopping = true;
+    multicore_reset_core1();
+    free(buffers);
+    buffers = NULL;
+}
+
+uint32_t comp_late_lines(void)
+{
+    return late;
+}
+
+uint32_t comp_collisions(void)
+{
+    return collisions;
+}
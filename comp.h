@@ -0,0 +1,80 @@
+/**
+ * Scan-out compositor
+ *
+ * Core 1 merges up to COMP_MAX_LAYERS surfaces into a ring of COMP_LINES
+ * line buffers just ahead of the beam, and the DMA sends those instead of
+ * vga_data_array (see vga_set_scan_table()). Nothing is merged into memory
+ * that outlives the line, so a menu or alert on a top layer can change or
+ * go away without redrawing anything below it.
+ *
+ * Each line starts from the lowest layer that covers it and only touches
+ * the spans of the layers that cross it. Opaque layers are copied, keyed
+ * layers merged 5 pixels at a time with the masks from swar.h. Pixels no
+ * layer covers are black. A line that isn't ready in time shows whatever
+ * its buffer held before and is counted by comp_late_lines().
+ *
+ * Collisions come out of the merge: a keyed layer's copy already works out
+ * which of its pixels are not the key, 5 at a time, and those masks are
+ * kept for the layers marked collide and ANDed where their spans overlap.
+ * A layer with a hit_color also checks the line below it for that color.
+ * The flags are pixel exact and collected over a frame, and only visible
+ * pixels count: nothing hidden under an opaque full-width layer collides.
+ *
+ * Drawing with gfx.h still goes to vga_data_array, which isn't shown while
+ * the compositor runs unless a layer uses it as its surface.
+ */
+
+#ifndef COMP_H
+#define COMP_H
+
+#include "vga.h"
+
+#define COMP_MAX_LAYERS 4
+
+// Line buffers in the ring, must divide VGA_HEIGHT
+#define COMP_LINES 4
+
+// Words of collision masks composing a line needs
+#define COMP_COVER_WORDS (COMP_MAX_LAYERS * VGA_LINE_WORDS)
+
+typedef struct
+{
+    const vga_surface_t *surface;
+    short x, y;                           // screen position of the surface
+    short clip_x, clip_y, clip_w, clip_h; // part of the screen it may cover
+    char key;                             // transparent color, with keyed
+    bool keyed;
+    bool enabled;
+    bool collide;                         // report overlaps with other such layers
+    short hit_color;                      // report covering this color, -1 for none
+} comp_layer_t;
+
+// Collision flags: layers a and b (different) showed pixels in the same
+// place, layer a covered a pixel of its hit_color
+#define COMP_HIT(a, b) (1u << ((a) < (b) ? (a) * COMP_MAX_LAYERS + (b) : (b) * COMP_MAX_LAYERS + (a)))
+#define COMP_HIT_COLOR(a) (1u << (COMP_MAX_LAYERS * COMP_MAX_LAYERS + (a)))
+
+// Replace the layers, bottom first. They are copied and take effect at the
+// start of the next frame, so changes never tear.
+void comp_set_layers(const comp_layer_t *layers, int count);
+
+// Start compositing on core 1 from the next frame on, and go back to
+// scanning out vga_data_array. The scan table and collision masks, about
+// 4 kB, come from the heap meanwhile; comp_start() returns false if there
+// isn't enough.
+bool comp_start(void);
+void comp_stop(void);
+
+// Lines that were not composed before they had to be sent
+uint32_t comp_late_lines(void);
+
+// Collision flags of the last whole frame composed
+uint32_t comp_collisions(void);
+
+// Compose line y of the given layers into a row of VGA_LINE_WORDS words,
+// what core 1 does for every line, with COMP_COVER_WORDS words of scratch
+// in cover for layers that collide or have a hit_color. Returns the line's
+// collision flags.
+uint32_t comp_compose_line(const comp_layer_t *layers, int count, int y, uint32_t *row, uint32_t *cover);
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * Hardware cursor, see cursor.h
+ */
+
+#include "cursor.h"
+#include "span.h"
+
+// Rows of 12 pixels in 3 words: white (0x3f) inside, black outline, and
+// magenta (VGA_RGB(3, 0, 3)) around it
+static const uint32_t arrow_words[] = {
+    0x00cf3cf3, 0x33cf3cf3, 0x33cf3cf3,
+    0x00033cf3, 0x33cf3cf3, 0x33cf3cf3,
+    0x00fc0cf3, 0x33cf3cf3, 0x33cf3cf3,
+    0x00fff033, 0x33cf3cf3, 0x33cf3cf3,
+    0x00ffffc0, 0x33cf3cf3, 0x33cf3cf3,
+    0x00ffffff, 0x00cf3cf3, 0x33cf3cf3,
+    0x00ffffff, 0x3f033cf3, 0x33cf3cf3,
+    0x00ffffff, 0x3ffc0cf3, 0x33cf3cf3,
+    0x00ffffff, 0x3ffff033, 0x33cf3cf3,
+    0x00ffffff, 0x3fffffc0, 0x33cf3cf3,
+    0x00ffffff, 0x3fffffff, 0x00cf3cf3,
+    0x00ffffff, 0x3ffc0000, 0x00033cf3,
+    0x00ffffc0, 0x3ffc0cf3, 0x33cf3cf3,
+    0x00fff000, 0x3ffc0cf3, 0x33cf3cf3,
+    0x00fc0cf3, 0x00fff033, 0x33cf3cf3,
+    0x00033cf3, 0x00fff033, 0x33cf3cf3,
+    0x00cf3cf3, 0x3303ffc0, 0x33cf3cf3,
+    0x33cf3cf3, 0x3303ffc0, 0x33cf3cf3,
+    0x33cf3cf3, 0x33cc0033, 0x33cf3cf3,
+};
+
+const cursor_image_t cursor_arrow = {{(uint32_t *)arrow_words, 12, 19, 3}, 0, 0, VGA_RGB(3, 0, 3)};
+
+// What core 0 asked for, taken over at the start of a frame. The position
+// is y in the upper and x in the lower half, so it changes in one store.
+static const cursor_image_t *volatile pending_image;
+static volatile uint32_t pending_position;
+
+// The cursor as shown this frame: image row 0 is at screen line top, and
+// lines y0..y1 (inclusive, empty when y0 > y1) show image pixels sx..sx + w - 1
+// at x0
+static const cursor_image_t *image;
+static int top, y0 = 1, y1 = 0;
+static int x0, sx, w;
+
+// Line y is merged into lines[y & 1], so the one still being sent is left
+// alone. They live in SCRATCH_Y with core 0's stack, where the interrupt
+// runs.
+static uint32_t __scratch_y("cursor") lines[2][VGA_LINE_WORDS];
+
+void cursor_set_image(const cursor_image_t *image)
+{
+    pending_image = image;
+}
+
+void cursor_move(int x, int y)
+{
+    pending_position = ((uint32_t)(uint16_t)y << 16) | (uint16_t)x;
+}
+
+void __not_in_flash_func(cursor_latch)(void)
+{
+    uint32_t position = pending_position;
+    image = pending_image;
+    y0 = 1;
+    y1 = 0;
+    if (!image)
+        return;
+
+    const vga_surface_t *s = &image->surface;
+    int width = s->width < CURSOR_MAX ? s->width : CURSOR_MAX;
+    int height = s->height < CURSOR_MAX ? s->height : CURSOR_MAX;
+    int left = (int16_t)position - image->hot_x;
+
+    top = (int16_t)(position >> 16) - image->hot_y;
+    x0 = left < 0 ? 0 : left;
+    sx = x0 - left;
+    w = (left + width > VGA_WIDTH ? VGA_WIDTH : left + width) - x0;
+    if (w <= 0)
+        return;
+    y0 = top < 0 ? 0 : top;
+    y1 = top + height > VGA_HEIGHT ? VGA_HEIGHT - 1 : top + height - 1;
+}
+
+uint32_t *__not_in_flash_func(cursor_line)(int y, const uint32_t *row)
+{
+    if (y < y0 || y > y1)
+        return NULL;
+
+    uint32_t *line = lines[y & 1];
+    for (int i = 0; i < VGA_LINE_WORDS; i++)
+        line[i] = row[i];
+
+    const vga_surface_t *s = &image->surface;
+    vga_span_copy_keyed(line, x0, surfaceRow(s, y - top), s->stride, sx, w, image->key & VGA_PIXEL_MASK);
+    return line;
+}
@@ -0,0 +1,46 @@
+/**
+ * Hardware cursor
+ *
+ * A small color-keyed image (up to CURSOR_MAX x CURSOR_MAX) shown on top of
+ * whatever is scanned out, without ever being drawn into vga_data_array.
+ * While the line before a cursor line goes out, the scan-out interrupt
+ * copies the cursor line into one of two line buffers, merges the cursor
+ * into it and has the DMA send that buffer instead. Moving the cursor is
+ * one 32-bit store, picked up when the next frame starts, so the cursor
+ * never tears and nothing has to be saved or restored under it.
+ *
+ * The frame and band CRCs (vga.h) see the cursor like any other pixels.
+ */
+
+#ifndef CURSOR_H
+#define CURSOR_H
+
+#include "vga.h"
+
+#define CURSOR_MAX 32
+
+typedef struct
+{
+    vga_surface_t surface; // larger images are cut to CURSOR_MAX
+    short hot_x, hot_y;    // pixel of the image that is at the position
+    char key;              // transparent color
+} cursor_image_t;
+
+// A 12x19 white arrow with a black outline, pointing at its top left pixel
+extern const cursor_image_t cursor_arrow;
+
+// Show an image as the cursor from the next frame on, or hide it with NULL.
+// The image has to stay valid while it is shown.
+void cursor_set_image(const cursor_image_t *image);
+
+// Put the cursor's hot spot at x, y from the next frame on. Parts outside
+// the screen are cut off.
+void cursor_move(int x, int y);
+
+// Called by the scan-out interrupt at the start of every frame, and for
+// every line with the row about to be sent: returns a line buffer with the
+// cursor merged into a copy of row, or NULL if the cursor isn't on line y
+void cursor_latch(void);
+uint32_t *cursor_line(int y, const uint32_t *row);
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * Color effects, see effect.h
+ */
+
+#include "effect.h"
+#include "span.h"
+#include "swar.h"
+
+// The second operand of an effect for every word: a levels word, except
+// for EFFECT_MASK which works on packed pixels
+static uint32_t operand(int effect, char arg)
+{
+    switch (effect)
+    {
+    case EFFECT_DARKEN:
+    case EFFECT_LIGHTEN:
+        return VGA_SWAR_LEVEL(arg & 3);
+    case EFFECT_MASK:
+        return VGA_SOLID(arg & VGA_PIXEL_MASK);
+    default:
+        return vga_swar_levels(VGA_SOLID(arg & VGA_PIXEL_MASK));
+    }
+}
+
+static inline uint32_t apply(uint32_t w, int effect, uint32_t op)
+{
+    switch (effect)
+    {
+    case EFFECT_DARKEN:
+    case EFFECT_SUBTRACT:
+        return vga_swar_levels(vga_swar_sub_sat(vga_swar_levels(w), op));
+    case EFFECT_LIGHTEN:
+    case EFFECT_ADD:
+        return vga_swar_levels(vga_swar_add_sat(vga_swar_levels(w), op));
+    case EFFECT_BLEND:
+        return vga_swar_levels(vga_swar_average(vga_swar_levels(w), op));
+    case EFFECT_MASK:
+        return w & op;
+    default:
+        return w;
+    }
+}
+
+// Each case gets its own loop so the kernel is inlined without a switch per
+// word
+#define EFFECT_LOOP(e)                         \
+    case e:                                    \
+        for (int i = 0; i < n; i++)            \
+            words[i] = apply(words[i], e, op); \
+        break
+
+static void VGA_RAM_FUNC(effect_words)(uint32_t *words, int n, int effect, uint32_t op)
+{
+    switch (effect)
+    {
+        EFFECT_LOOP(EFFECT_DARKEN);
+        EFFECT_LOOP(EFFECT_LIGHTEN);
+        EFFECT_LOOP(EFFECT_ADD);
+        EFFECT_LOOP(EFFECT_SUBTRACT);
+        EFFECT_LOOP(EFFECT_BLEND);
+        EFFECT_LOOP(EFFECT_MASK);
+    }
+}
+
+static inline void effect_masked(uint32_t *word, int effect, uint32_t op, uint32_t mask)
+{
+    *word = (*word & ~mask) | (apply(*word, effect, op) & mask);
+}
+
+// Apply to pixels x0..x1 (inclusive, already clipped) of a row
+static void VGA_RAM_FUNC(effect_span)(uint32_t *row, int x0, int x1, int effect, uint32_t op)
+{
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    if (w0 == w1)
+    {
+        effect_masked(&row[w0], effect, op, VGA_SPAN_MASK(x0 % 5, x1 % 5));
+        return;
+    }
+
+    effect_masked(&row[w0], effect, op, VGA_SPAN_MASK(x0 % 5, 4));
+    effect_words(&row[w0 + 1], w1 - w0 - 1, effect, op);
+    effect_masked(&row[w1], effect, op, VGA_SPAN_MASK(0, x1 % 5));
+}
+
+void VGA_RAM_FUNC(effectRect)(int x, int y, int w, int h, int effect, char arg)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+
+    uint32_t op = operand(effect, arg);
+    for (int row = y; row < y + h; row++)
+        effect_span(vga_row(row), x, x + w - 1, effect, op);
+}
+
+void VGA_RAM_FUNC(effectSurface)(const vga_surface_t *s, int x, int y, int w, int h, int effect, char arg)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, s->width, s->height))
+        return;
+
+    uint32_t op = operand(effect, arg);
+    for (int row = y; row < y + h; row++)
+        effect_span(surfaceRow(s, row), x, x + w - 1, effect, op);
+}
@@ -0,0 +1,39 @@
+/**
+ * Per-channel color effects on rectangles of the screen or of a surface
+ *
+ * Every effect works on whole packed words (5 pixels, 15 channels) with the
+ * SWAR kernels in swar.h, so no pixel is unpacked. Channels saturate at 0
+ * and 3.
+ *
+ *  EFFECT_DARKEN    fade toward black by arg (0-3) levels
+ *  EFFECT_LIGHTEN   fade toward white by arg (0-3) levels
+ *  EFFECT_ADD       add the channels of color arg
+ *  EFFECT_SUBTRACT  subtract the channels of color arg
+ *  EFFECT_BLEND     50% average with color arg, rounded down
+ *  EFFECT_MASK      keep only the channel bits set in color arg, so
+ *                   VGA_RGB(3, 0, 0) leaves just the red channel
+ *
+ * The functions keep no state and can run on both cores at once, on
+ * different rectangles.
+ */
+
+#ifndef EFFECT_H
+#define EFFECT_H
+
+#include "vga.h"
+
+#define EFFECT_DARKEN 0
+#define EFFECT_LIGHTEN 1
+#define EFFECT_ADD 2
+#define EFFECT_SUBTRACT 3
+#define EFFECT_BLEND 4
+#define EFFECT_MASK 5
+#define EFFECT_COUNT 6
+
+// Apply an effect to a rectangle of the screen, clipped to the screen
+void effectRect(int x, int y, int w, int h, int effect, char arg);
+
+// The same on a surface in RAM, clipped to the surface
+void effectSurface(const vga_surface_t *s, int x, int y, int w, int h, int effect, char arg);
+
+#endif
@@ -0,0 +1,258 @@
+/**
+ * Flood fill, see flood.h
+ */
+
+#include <string.h>
+#include "flood.h"
+#include "gfx.h"
+#include "swar.h"
+
+// Row y - dy was filled from xl to xr, row y is still to be looked at
+typedef struct
+{
+    int16_t y, xl, xr, dy;
+} flood_span_t;
+
+typedef struct
+{
+    flood_span_t *stack;
+    int size, top;
+    uint32_t old; // region color in all 5 pixels
+    char color;   // what is drawn, a marker when the new color is on the screen
+    // Rows of the spans that did not fit on the stack, and the columns
+    // they covered
+    uint32_t dropped[(VGA_HEIGHT + 31) / 32];
+    int drop_x0, drop_x1;
+    // Bounds of what has been drawn
+    int x0, y0, x1, y1;
+} flood_t;
+
+// Top-of-field flags of the pixels of a word that are not the old color
+static inline uint32_t others(const flood_t *f, uint32_t w)
+{
+    return vga_swar_nonzero(w ^ f->old);
+}
+
+// First x in x..limit that is not the old color, limit + 1 if none
+static int VGA_RAM_FUNC(run_end)(const flood_t *f, const uint32_t *row, int x, int limit)
+{
+    while (x <= limit)
+    {
+        int i = x % 5;
+        uint32_t flags = others(f, row[x / 5]) & ((1u << (30 - 6 * i)) - 1);
+        if (flags)
+        {
+            x += (__builtin_clz(flags) - 2) / 6 - i;
+            return x <= limit ? x : limit + 1;
+        }
+        x += 5 - i;
+    }
+    return limit + 1;
+}
+
+// Last x in limit..x that is not the old color, limit - 1 if none
+static int VGA_RAM_FUNC(run_start)(const flood_t *f, const uint32_t *row, int x, int limit)
+{
+    while (x >= limit)
+    {
+        int i = x % 5;
+        uint32_t flags = others(f, row[x / 5]) & ~((1u << (29 - 6 * i)) - 1);
+        if (flags)
+        {
+            x -= i - (29 - __builtin_ctz(flags)) / 6;
+            return x >= limit ? x : limit - 1;
+        }
+        x -= i + 1;
+    }
+    return limit - 1;
+}
+
+// First x in x..limit that is the old color, limit + 1 if none
+static int VGA_RAM_FUNC(run_next)(const flood_t *f, const uint32_t *row, int x, int limit)
+{
+    while (x <= limit)
+    {
+        int i = x % 5;
+        uint32_t same = ~others(f, row[x / 5]) & VGA_SWAR_HIGH & ((1u << (30 - 6 * i)) - 1);
+        if (same)
+        {
+            x += (__builtin_clz(same) - 2) / 6 - i;
+            return x <= limit ? x : limit + 1;
+        }
+        x += 5 - i;
+    }
+    return limit + 1;
+}
+
+static void push(flood_t *f, int y, int xl, int xr, int dy)
+{
+    if (y + dy < 0 || y + dy >= VGA_HEIGHT)
+        return;
+    if (f->top == f->size)
+    {
+        f->dropped[(y + dy) / 32] |= 1u << ((y + dy) % 32);
+        if (xl < f->drop_x0)
+            f->drop_x0 = xl;
+        if (xr > f->drop_x1)
+            f->drop_x1 = xr;
+        return;
+    }
+    f->stack[f->top++] = (flood_span_t){y + dy, xl, xr, dy};
+}
+
+// Fill the old color in row y from x1 to x2 and everything connected to it
+// that fits on the stack
+static void VGA_RAM_FUNC(fill_from)(flood_t *f, int y, int x1, int x2)
+{
+    // Look below, and first at row y itself going up
+    push(f, y, x1, x2, 1);
+    push(f, y + 1, x1, x2, -1);
+
+    while (f->top > 0)
+    {
+        flood_span_t s = f->stack[--f->top];
+        const uint32_t *row = vga_row(s.y);
+        int x = s.xl;
+        int l;
+
+        // The run through xl can reach left of the span above it
+        if (run_end(f, row, x, x) > x)
+        {
+            l = run_start(f, row, x, 0) + 1;
+            if (l < s.xl)
+                push(f, s.y, l, s.xl - 1, -s.dy);
+        }
+        else
+            l = x = run_next(f, row, x, s.xr);
+
+        while (x <= s.xr)
+        {
+            x = run_end(f, row, x, VGA_WIDTH - 1);
+            drawHLine(l, s.y, x - l, f->color);
+            if (l < f->x0)
+                f->x0 = l;
+            if (x - 1 > f->x1)
+                f->x1 = x - 1;
+            if (s.y < f->y0)
+                f->y0 = s.y;
+            if (s.y > f->y1)
+                f->y1 = s.y;
+            push(f, s.y, l, x - 1, s.dy);
+            if (x > s.xr + 1)
+                push(f, s.y, s.xr + 1, x - 1, -s.dy);
+            l = x = run_next(f, row, x + 1, s.xr);
+        }
+    }
+}
+
+// Whether any pixel in xl..xr of row y is the color being drawn
+static bool touches(const flood_t *f, int y, int xl, int xr)
+{
+    if (y < 0 || y >= VGA_HEIGHT)
+        return false;
+    for (int x = xl; x <= xr; x++)
+        if (((vga_row(y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK) == (uint32_t)f->color)
+            return true;
+    return false;
+}
+
+// Mark the colors on the screen in seen, one byte each, which is quicker
+// than a bit mask on the M0+
+static void VGA_RAM_FUNC(screen_colors)(uint8_t seen[64])
+{
+    memset(seen, 0, 64);
+    for (int y = 0; y < VGA_HEIGHT; y++)
+    {
+        const uint32_t *row = vga_row(y);
+        for (int i = 0; i < VGA_LINE_WORDS; i++)
+        {
+            uint32_t w = row[i];
+            seen[w & 63] = 1;
+            seen[(w >> 6) & 63] = 1;
+            seen[(w >> 12) & 63] = 1;
+            seen[(w >> 18) & 63] = 1;
+            seen[(w >> 24) & 63] = 1;
+        }
+    }
+}
+
+// Recolor the marker to the new color where the fill drew
+static void VGA_RAM_FUNC(recolor)(const flood_t *f, char color)
+{
+    for (int y = f->y0; y <= f->y1; y++)
+    {
+        uint32_t *row = vga_row(y);
+        for (int i = f->x0 / 5; i <= f->x1 / 5; i++)
+        {
+            uint32_t keep = vga_swar_key_mask(row[i], f->color);
+            if (keep != VGA_WORD_MASK)
+                row[i] = (row[i] & keep) | (VGA_SOLID(color) & ~keep);
+        }
+    }
+}
+
+int VGA_RAM_FUNC(floodFill)(int x, int y, char color, void *stack, int bytes)
+{
+    color &= VGA_PIXEL_MASK;
+    if (x < 0 || x >= VGA_WIDTH || y < 0 || y >= VGA_HEIGHT || bytes < FLOOD_ENTRY_BYTES)
+        return 0;
+
+    int old = (vga_row(y)[x / 5] >> VGA_PIXEL_SHIFT(x % 5)) & VGA_PIXEL_MASK;
+    if (old == color)
+        return 0;
+
+    // The passes below find what the fill drew by its color, so it draws
+    // in one that isn't on the screen: the new color if it isn't there
+    // already, else a free one that is recolored at the end
+    uint8_t seen[64];
+    int marker = color;
+    screen_colors(seen);
+    for (int c = 0; seen[marker] && c < 64; c++)
+        if (!seen[c])
+            marker = c;
+
+    flood_t f = {stack, bytes / FLOOD_ENTRY_BYTES, 0, VGA_SOLID(old), marker, {0}, VGA_WIDTH, -1,
+                 VGA_WIDTH, VGA_HEIGHT, -1, -1};
+    fill_from(&f, y, x, x);
+
+    // With every color on the screen the passes could fill areas the new
+    // color already touched, so stop short instead
+    if (seen[marker] && f.drop_x1 >= 0)
+        return FLOOD_INCOMPLETE;
+
+    // Pick up what was dropped: runs of the old color on the rows of dropped
+    // spans, in their columns, below or above a pixel the fill drew. The
+    // filled runs above and below those spans are such pixels, and filling
+    // can drop more.
+    int passes = 1;
+    while (f.drop_x1 >= 0)
+    {
+        uint32_t rows[count_of(f.dropped)];
+        int x0 = f.drop_x0, x1 = f.drop_x1;
+
+        memcpy(rows, f.dropped, sizeof(rows));
+        memset(f.dropped, 0, sizeof(f.dropped));
+        f.drop_x0 = VGA_WIDTH;
+        f.drop_x1 = -1;
+        passes++;
+
+        for (int row = 0; row < VGA_HEIGHT; row++)
+        {
+            if (!(rows[row / 32] & (1u << (row % 32))))
+                continue;
+
+            const uint32_t *pixels = vga_row(row);
+            for (int l = run_next(&f, pixels, x0, x1); l <= x1; l = run_next(&f, pixels, l, x1))
+            {
+                int r = run_end(&f, pixels, l, VGA_WIDTH - 1) - 1;
+                int cl = l > x0 ? l : x0, cr = r < x1 ? r : x1;
+                if (touches(&f, row - 1, cl, cr) || touches(&f, row + 1, cl, cr))
+                    fill_from(&f, row, l, r);
+                l = r + 1;
+            }
+        }
+    }
+    if (marker != color)
+        recolor(&f, color);
+    return passes;
+}
@@ -0,0 +1,38 @@
+/**
+ * Scanline flood fill with bounded memory
+ *
+ * floodFill() recolors the 4-connected region of the color at (x, y). It
+ * works on horizontal runs: runs are found by comparing whole packed words
+ * against the region color (see swar.h), drawn with drawHLine(), and the
+ * runs still to be explored above and below go on a stack the caller
+ * provides, 8 bytes per entry. A few hundred bytes do for most shapes.
+ *
+ * When the stack is full the fill goes on without the runs that did not
+ * fit, noting only their rows and the columns they spanned. Further passes
+ * look along those rows for runs of the old color below or above pixels the
+ * fill drew and fill from there, until nothing more is dropped.
+ *
+ * To tell what it drew from what was there, the fill draws in a color that
+ * is not on the screen, found by one scan of the framebuffer: the new color
+ * itself if it isn't there yet, else a free one that is recolored to the
+ * new color at the end. The result is exact either way. Only with all 64
+ * colors on the screen is there none; the fill then makes one pass and
+ * returns FLOOD_INCOMPLETE if it dropped anything, leaving those parts in
+ * the old color rather than guessing.
+ */
+
+#ifndef FLOOD_H
+#define FLOOD_H
+
+#include "vga.h"
+
+// Bytes of stack per entry
+#define FLOOD_ENTRY_BYTES 8
+
+// Returned when runs were dropped but the fill couldn't go back for them
+#define FLOOD_INCOMPLETE -1
+
+// Returns the number of passes made, 0 if there was nothing to fill
+int floodFill(int x, int y, char color, void *stack, int bytes);
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * Bitmap font used by drawChar() and drawString()
+ *
+ * Glyphs are 5x7 pixels drawn in a 6x8 cell, which gives 106 columns and 60
+ * rows of text on the 640x480 screen.
+ */
+
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdint.h>
+
+#define FONT_WIDTH 6
+#define FONT_HEIGHT 8
+#define FONT_ROWS 7
+#define FONT_FIRST 0x20
+#define FONT_GLYPHS 95
+
+extern const uint8_t font_5x7[FONT_GLYPHS][FONT_ROWS];
+
+#endif
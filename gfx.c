@@ -0,0 +1,429 @@
+/**
+ * Drawing primitives for the VGA screen, see gfx.h
+ */
+
+#include <stdlib.h>
+#include "gfx.h"
+#include "font.h"
+#include "span.h"
+
+// Font rows pre-packed into pixel masks: entry p covers pixel i of a word
+// when bit 4-i of p is set, so a glyph row indexes it directly
+static const uint32_t VGA_RAM_DATA("gfx") expand5[32] = {
+    0x00000000, 0x0000003f, 0x00000fc0, 0x00000fff,
+    0x0003f000, 0x0003f03f, 0x0003ffc0, 0x0003ffff,
+    0x00fc0000, 0x00fc003f, 0x00fc0fc0, 0x00fc0fff,
+    0x00fff000, 0x00fff03f, 0x00ffffc0, 0x00ffffff,
+    0x3f000000, 0x3f00003f, 0x3f000fc0, 0x3f000fff,
+    0x3f03f000, 0x3f03f03f, 0x3f03ffc0, 0x3f03ffff,
+    0x3ffc0000, 0x3ffc003f, 0x3ffc0fc0, 0x3ffc0fff,
+    0x3ffff000, 0x3ffff03f, 0x3fffffc0, 0x3fffffff,
+};
+
+static inline void put_pixel(uint32_t *row, int x, uint32_t color)
+{
+    uint32_t *word = &row[x / 5];
+    int shift = VGA_PIXEL_SHIFT(x % 5);
+    *word = (*word & ~(VGA_PIXEL_MASK << shift)) | (color << shift);
+}
+
+// Fill pixels x0..x1 (inclusive, already clipped) of a row from a tile of 8
+// words, word i of the row taking tile[i % 8]
+static void VGA_RAM_FUNC(tile_span)(uint32_t *row, int x0, int x1, const uint32_t *tile)
+{
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    if (w0 == w1)
+    {
+        vga_put_masked(&row[w0], tile[w0 & 7], VGA_SPAN_MASK(x0 % 5, x1 % 5));
+        return;
+    }
+
+    vga_put_masked(&row[w0], tile[w0 & 7], VGA_SPAN_MASK(x0 % 5, 4));
+    for (int i = w0 + 1; i < w1; i++)
+        row[i] = tile[i & 7];
+    vga_put_masked(&row[w1], tile[w1 & 7], VGA_SPAN_MASK(0, x1 % 5));
+}
+
+void VGA_RAM_FUNC(drawHLine)(int x, int y, int w, char color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+// Vertical lines change the same bits of the same word in every row, so
+// those are worked out once and each pixel is a read-modify-write through
+// the line table
+void VGA_RAM_FUNC(drawVLine)(int x, int y, int h, char color)
+{
+    if (x < 0 || x >= VGA_WIDTH)
+        return;
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (y + h > VGA_HEIGHT)
+        h = VGA_HEIGHT - y;
+    if (h <= 0)
+        return;
+
+    int word = x / 5;
+    int shift = VGA_PIXEL_SHIFT(x % 5);
+    uint32_t keep = ~(VGA_PIXEL_MASK << shift);
+    uint32_t bits = (color & VGA_PIXEL_MASK) << shift;
+    uint32_t *const *rows = &vga_line_table[y];
+
+    for (int i = 0; i < h; i++)
+    {
+        uint32_t *p = &rows[i][word];
+        *p = (*p & keep) | bits;
+    }
+}
+
+void VGA_RAM_FUNC(drawVLineTextured)(int x, int y, int h, const vga_texture_t *tex, int u, int32_t v, int32_t dv)
+{
+    if (x < 0 || x >= VGA_WIDTH)
+        return;
+    if (y < 0)
+    {
+        h += y;
+        v -= y * dv;
+        y = 0;
+    }
+    if (y + h > VGA_HEIGHT)
+        h = VGA_HEIGHT - y;
+    if (h <= 0)
+        return;
+
+    int word = x / 5;
+    int shift = VGA_PIXEL_SHIFT(x % 5);
+    uint32_t keep = ~(VGA_PIXEL_MASK << shift);
+    uint32_t *const *rows = &vga_line_table[y];
+    const uint8_t *column = tex->pixels + (u & ((1 << tex->width_bits) - 1));
+    uint32_t row_mask = (1u << tex->height_bits) - 1;
+    int width_bits = tex->width_bits;
+
+    for (int i = 0; i < h; i++)
+    {
+        uint32_t texel = column[((v >> 16) & row_mask) << width_bits];
+        uint32_t *p = &rows[i][word];
+        *p = (*p & keep) | ((texel & VGA_PIXEL_MASK) << shift);
+        v += dv;
+    }
+}
+
+void VGA_RAM_FUNC(fillRect)(int x, int y, int w, int h, char color)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+
+    for (int row = y; row < y + h; row++)
+        vga_span_fill(vga_row(row), x, x + w - 1, color & VGA_PIXEL_MASK);
+}
+
+void VGA_RAM_FUNC(fillSpanTile)(int x, int y, int w, const uint32_t tile[8])
+{
+    if (y < 0 || y >= VGA_HEIGHT)
+        return;
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (x + w > VGA_WIDTH)
+        w = VGA_WIDTH - x;
+    if (w <= 0)
+        return;
+
+    tile_span(vga_row(y), x, x + w - 1, tile);
+}
+
+void makePattern(vga_pattern_t *p, const uint8_t pixels[64])
+{
+    for (int y = 0; y < 8; y++)
+        for (int i = 0; i < 8; i++)
+        {
+            uint32_t word = 0;
+            for (int k = 0; k < 5; k++)
+                word = (word << 6) | (pixels[y * 8 + ((i * 5 + k) & 7)] & VGA_PIXEL_MASK);
+            p->words[y][i] = word;
+        }
+}
+
+void makeStipple(vga_pattern_t *p, const uint8_t bits[8], char fg, char bg)
+{
+    uint8_t pixels[64];
+
+    for (int y = 0; y < 8; y++)
+        for (int x = 0; x < 8; x++)
+            pixels[y * 8 + x] = (bits[y] & (0x80 >> x)) ? fg : bg;
+    makePattern(p, pixels);
+}
+
+void VGA_RAM_FUNC(fillRectPattern)(int x, int y, int w, int h, const vga_pattern_t *p)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+
+    for (int row = y; row < y + h; row++)
+        tile_span(vga_row(row), x, x + w - 1, p->words[row & 7]);
+}
+
+void VGA_RAM_FUNC(drawRect)(int x, int y, int w, int h, char color)
+{
+    if (w <= 0 || h <= 0)
+        return;
+
+    drawHLine(x, y, w, color);
+    drawHLine(x, y + h - 1, w, color);
+    drawVLine(x, y, h, color);
+    drawVLine(x + w - 1, y, h, color);
+}
+
+// A triangle edge from (xa, ya) down to (xb, yb), yb > ya: its x at the
+// center of a row and the step per row, in 16.16
+typedef struct
+{
+    int32_t x, step;
+} edge_t;
+
+static inline edge_t edge_at(int xa, int ya, int xb, int yb, int y)
+{
+    edge_t e;
+    e.step = (xb - xa) * 65536 / (yb - ya);
+    e.x = xa * 65536 + e.step * (y - ya) + e.step / 2;
+    return e;
+}
+
+void VGA_RAM_FUNC(fillTriangle)(int x0, int y0, int x1, int y1, int x2, int y2, char color)
+{
+    int t;
+    if (y1 < y0)
+    {
+        t = x0, x0 = x1, x1 = t;
+        t = y0, y0 = y1, y1 = t;
+    }
+    if (y2 < y1)
+    {
+        t = x1, x1 = x2, x2 = t;
+        t = y1, y1 = y2, y2 = t;
+    }
+    if (y1 < y0)
+    {
+        t = x0, x0 = x1, x1 = t;
+        t = y0, y0 = y1, y1 = t;
+    }
+
+    int y = y0 < 0 ? 0 : y0;
+    int end = y2 > VGA_HEIGHT ? VGA_HEIGHT : y2;
+    if (y >= end)
+        return;
+
+    // Rows whose centers are inside, and in them the pixels whose centers
+    // are, so triangles sharing an edge neither overlap nor leave gaps
+    edge_t longest = edge_at(x0, y0, x2, y2, y);
+    edge_t other = y < y1 ? edge_at(x0, y0, x1, y1, y) : edge_at(x1, y1, x2, y2, y);
+    uint32_t c = color & VGA_PIXEL_MASK;
+
+    for (; y < end; y++)
+    {
+        if (y == y1)
+            other = edge_at(x1, y1, x2, y2, y);
+
+        int32_t a = longest.x < other.x ? longest.x : other.x;
+        int32_t b = longest.x < other.x ? other.x : longest.x;
+        int left = (a + 32767) >> 16;
+        int right = ((b + 32767) >> 16) - 1;
+        if (left < 0)
+            left = 0;
+        if (right > VGA_WIDTH - 1)
+            right = VGA_WIDTH - 1;
+        if (left <= right)
+            vga_span_fill(vga_row(y), left, right, c);
+
+        longest.x += longest.step;
+        other.x += other.step;
+    }
+}
+
+void VGA_RAM_FUNC(drawLine)(int x0, int y0, int x1, int y1, char color)
+{
+    if (y0 == y1)
+    {
+        if (x1 < x0)
+            drawHLine(x1, y0, x0 - x1 + 1, color);
+        else
+            drawHLine(x0, y0, x1 - x0 + 1, color);
+        return;
+    }
+
+    // Bresenham, clipping each pixel
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    uint32_t c = color & VGA_PIXEL_MASK;
+
+    while (true)
+    {
+        if (x0 >= 0 && x0 < VGA_WIDTH && y0 >= 0 && y0 < VGA_HEIGHT)
+            put_pixel(vga_row(y0), x0, c);
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+// A whole cell on screen. Its 6 pixels start at pixel a of word w and end at
+// pixel a of word w + 1, so each glyph row is two masked word writes.
+static void VGA_RAM_FUNC(draw_cell)(int x, int y, const uint8_t *glyph, uint32_t fg, uint32_t back, bool opaque)
+{
+    int w = x / 5;
+    int a = x % 5;
+    uint32_t hi_region = VGA_SPAN_MASK(a, 4);
+    uint32_t lo_region = VGA_SPAN_MASK(0, a);
+    uint32_t solid_fg = VGA_SOLID(fg);
+    uint32_t solid_bg = VGA_SOLID(back);
+
+    for (int row = 0; row < FONT_HEIGHT; row++)
+    {
+        uint32_t *line = vga_row(y + row) + w;
+        // Shifted left by one the spacing column becomes bit 0
+        uint32_t bits = row < FONT_ROWS ? glyph[row] : 0;
+        uint32_t hi = expand5[bits >> a];
+        uint32_t lo = expand5[((bits << 1) << (4 - a)) & 31];
+
+        if (opaque)
+        {
+            vga_put_masked(&line[0], solid_bg ^ ((solid_bg ^ solid_fg) & hi), hi_region);
+            vga_put_masked(&line[1], solid_bg ^ ((solid_bg ^ solid_fg) & lo), lo_region);
+        }
+        else
+        {
+            vga_put_masked(&line[0], solid_fg, hi & hi_region);
+            vga_put_masked(&line[1], solid_fg, lo & lo_region);
+        }
+    }
+}
+
+void VGA_RAM_FUNC(drawChar)(int x, int y, unsigned char c, char color, char bg)
+{
+    if (c < FONT_FIRST || c >= FONT_FIRST + FONT_GLYPHS)
+        c = '?';
+
+    const uint8_t *glyph = font_5x7[c - FONT_FIRST];
+    uint32_t fg = color & VGA_PIXEL_MASK;
+    uint32_t back = bg & VGA_PIXEL_MASK;
+    bool opaque = fg != back;
+
+    if (x >= 0 && x + FONT_WIDTH <= VGA_WIDTH && y >= 0 && y + FONT_HEIGHT <= VGA_HEIGHT)
+    {
+        draw_cell(x, y, glyph, fg, back, opaque);
+        return;
+    }
+
+    for (int row = 0; row < FONT_HEIGHT; row++)
+    {
+        int py = y + row;
+        if (py < 0 || py >= VGA_HEIGHT)
+            continue;
+
+        uint32_t *line = vga_row(py);
+        uint8_t bits = row < FONT_ROWS ? glyph[row] : 0;
+        for (int col = 0; col < FONT_WIDTH; col++)
+        {
+            int px = x + col;
+            if (px < 0 || px >= VGA_WIDTH)
+                continue;
+
+            // Bit 4 is the leftmost pixel, column 5 is spacing
+            if (bits & (0x10 >> col))
+                put_pixel(line, px, fg);
+            else if (opaque)
+                put_pixel(line, px, back);
+        }
+    }
+}
+
+void VGA_RAM_FUNC(drawString)(int x, int y, const char *s, char color, char bg)
+{
+    for (; *s; s++)
+    {
+        drawChar(x, y, *s, color, bg);
+        x += FONT_WIDTH;
+    }
+}
+
+// Clip a blit against the source and the screen. Returns false if nothing
+// is left to draw.
+static bool clip_blit(const vga_surface_t *src, int *sx, int *sy, int *w, int *h, int *dx, int *dy)
+{
+    // Clip against the source
+    if (*sx < 0)
+    {
+        *w += *sx;
+        *dx -= *sx;
+        *sx = 0;
+    }
+    if (*sy < 0)
+    {
+        *h += *sy;
+        *dy -= *sy;
+        *sy = 0;
+    }
+    if (*sx + *w > src->width)
+        *w = src->width - *sx;
+    if (*sy + *h > src->height)
+        *h = src->height - *sy;
+
+    // and against the screen
+    if (*dx < 0)
+    {
+        *w += *dx;
+        *sx -= *dx;
+        *dx = 0;
+    }
+    if (*dy < 0)
+    {
+        *h += *dy;
+        *sy -= *dy;
+        *dy = 0;
+    }
+    if (*dx + *w > VGA_WIDTH)
+        *w = VGA_WIDTH - *dx;
+    if (*dy + *h > VGA_HEIGHT)
+        *h = VGA_HEIGHT - *dy;
+    return *w > 0 && *h > 0;
+}
+
+void VGA_RAM_FUNC(blitSurface)(const vga_surface_t *src, int sx, int sy, int w, int h, int dx, int dy)
+{
+    if (!clip_blit(src, &sx, &sy, &w, &h, &dx, &dy))
+        return;
+
+    for (int row = 0; row < h; row++)
+        vga_span_copy(vga_row(dy + row), dx, surfaceRow(src, sy + row), src->stride, sx, w);
+}
+
+void VGA_RAM_FUNC(blitSurfaceKeyed)(const vga_surface_t *src, int sx, int sy, int w, int h, int dx, int dy, char key)
+{
+    if (!clip_blit(src, &sx, &sy, &w, &h, &dx, &dy))
+        return;
+
+    for (int row = 0; row < h; row++)
+        vga_span_copy_keyed(vga_row(dy + row), dx, surfaceRow(src, sy + row), src->stride, sx, w,
+                            key & VGA_PIXEL_MASK);
+}
@@ -0,0 +1,59 @@
+/**
+ * Drawing primitives for the VGA screen
+ *
+ * Everything is clipped to the 640x480 screen. Spans and rectangles write a
+ * whole word (5 pixels) at a time and only read-modify-write the partial
+ * words at either end.
+ */
+
+#ifndef GFX_H
+#define GFX_H
+
+#include "vga.h"
+
+void drawHLine(int x, int y, int w, char color);
+void drawVLine(int x, int y, int h, char color);
+void fillRect(int x, int y, int w, int h, char color);
+void drawRect(int x, int y, int w, int h, char color);
+void drawLine(int x0, int y0, int x1, int y1, char color);
+
+// Fill the pixels whose centers are inside a triangle, row by row as spans
+void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, char color);
+
+// A vertical line of h pixels down from (x, y) taken from column u of a
+// texture, starting at texture row v and moving dv rows per pixel (both
+// 16.16 fixed point). Texture coordinates wrap around.
+void drawVLineTextured(int x, int y, int h, const vga_texture_t *tex, int u, int32_t v, int32_t dv);
+
+// An 8x8 pattern anchored to the screen and packed for it: words[y % 8][i % 8]
+// is word i (pixels 5i to 5i + 4) of screen row y. A fill copies whole
+// words and never touches single pixels.
+typedef struct
+{
+    uint32_t words[8][8];
+} vga_pattern_t;
+
+// Pack 8 rows of 8 pixels
+void makePattern(vga_pattern_t *p, const uint8_t pixels[64]);
+
+// Pack a two-color pattern, the top bit of each row byte being its left pixel
+void makeStipple(vga_pattern_t *p, const uint8_t bits[8], char fg, char bg);
+
+void fillRectPattern(int x, int y, int w, int h, const vga_pattern_t *p);
+
+// Fill w pixels of row y, screen word i taking tile[i % 8]
+void fillSpanTile(int x, int y, int w, const uint32_t tile[8]);
+
+// Text uses the 6x8 cell font from font.h. If bg is the same as color the
+// background is left untouched.
+void drawChar(int x, int y, unsigned char c, char color, char bg);
+void drawString(int x, int y, const char *s, char color, char bg);
+
+// Copy a w x h block of a surface to the screen at (dx, dy)
+void blitSurface(const vga_surface_t *src, int sx, int sy, int w, int h, int dx, int dy);
+
+// The same, except source pixels of the key color are transparent. The key
+// is matched on 5 pixels at a time (see swar.h).
+void blitSurfaceKeyed(const vga_surface_t *src, int sx, int sy, int w, int h, int dx, int dy, char key);
+
+#endif
@@ -0,0 +1,235 @@
+/**
+ * Graphics coprocessor mode, see gpu.h and gpu_proto.h
+ */
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#ifdef GPU_UART
+#include "hardware/uart.h"
+#endif
+#include "vga.h"
+#include "gfx.h"
+#include "font.h"
+#include "assets.h"
+#include "gpu.h"
+#include "gpu_proto.h"
+
+// Time between ACKs while the host is waiting on the queue to drain
+#define ACK_INTERVAL_US 1000
+
+// Commands parsed by core 0 and drawn by core 1
+static gpu_cmd_t queue[GPU_QUEUE];
+static volatile uint32_t queue_head; // written by core 0
+static volatile uint32_t queue_tail; // written by core 1
+static volatile uint32_t done;       // written by core 1
+
+// Bytes received but not parsed yet
+static uint8_t rx[GPU_WINDOW];
+static uint32_t rx_head;
+static uint32_t rx_tail;
+
+static gpu_parser_t parser;
+static uint32_t consumed;
+static uint32_t command_start; // consumed at the start of the command being parsed
+static uint32_t rejected;      // bytes of commands the parser dropped
+static uint32_t acked_consumed;
+static uint32_t acked_done;
+static uint32_t last_ack_us;
+
+static int transport_getc()
+{
+#ifdef GPU_UART
+    return uart_is_readable(uart1) ? uart_getc(uart1) : -1;
+#else
+    int c = getchar_timeout_us(0);
+    return c == PICO_ERROR_TIMEOUT ? -1 : c;
+#endif
+}
+
+static void transport_write(const uint8_t *buf, int len)
+{
+    for (int i = 0; i < len; i++)
+    {
+#ifdef GPU_UART
+        uart_putc_raw(uart1, buf[i]);
+#else
+        putchar_raw(buf[i]);
+#endif
+    }
+#ifndef GPU_UART
+    stdio_flush();
+#endif
+}
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    put_u16(p, v);
+    put_u16(p + 2, v >> 16);
+}
+
+static void send_ack()
+{
+    uint8_t reply[GPU_ACK_LENGTH];
+
+    acked_consumed = consumed;
+    acked_done = done + rejected;
+    last_ack_us = time_us_32();
+
+    reply[0] = GPU_REPLY_ACK;
+    put_u32(&reply[1], acked_consumed);
+    put_u32(&reply[5], acked_done);
+    transport_write(reply, sizeof(reply));
+}
+
+static void send_error(uint32_t offset, uint8_t op)
+{
+    uint8_t reply[GPU_ERROR_LENGTH];
+
+    reply[0] = GPU_REPLY_ERROR;
+    put_u32(&reply[1], offset);
+    reply[5] = op;
+    transport_write(reply, sizeof(reply));
+}
+
+static void hello()
+{
+    uint8_t reply[GPU_HELLO_LENGTH];
+
+    // Let core 1 finish so the counters start again from a quiet state
+    while (queue_tail != queue_head)
+        tight_loop_contents();
+    consumed = 0;
+    done = 0;
+    command_start = 0;
+    rejected = 0;
+    acked_consumed = 0;
+    acked_done = 0;
+
+    reply[0] = GPU_REPLY_HELLO;
+    reply[1] = GPU_VERSION;
+    put_u16(&reply[2], GPU_WINDOW);
+    put_u16(&reply[4], VGA_WIDTH);
+    put_u16(&reply[6], VGA_HEIGHT);
+    transport_write(reply, sizeof(reply));
+}
+
+static void execute(const gpu_cmd_t *cmd)
+{
+    switch (cmd->op)
+    {
+    case GPU_RECT:
+        fillRect(cmd->a, cmd->b, cmd->c, cmd->d, cmd->color);
+        break;
+    case GPU_SPAN:
+        drawHLine(cmd->a, cmd->b, cmd->c, cmd->color);
+        break;
+    case GPU_LINE:
+        drawLine(cmd->a, cmd->b, cmd->c, cmd->d, cmd->color);
+        break;
+    case GPU_TEXT:
+        for (int i = 0; i < cmd->len; i++)
+            drawChar(cmd->a + i * FONT_WIDTH, cmd->b, cmd->text[i], cmd->color, cmd->bg);
+        break;
+    case GPU_BLIT:
+        if (cmd->a < ASSET_COUNT)
+        {
+            const vga_surface_t *asset = &vga_assets[cmd->a];
+            blitSurface(asset, 0, 0, asset->width, asset->height, cmd->b, cmd->c);
+        }
+        break;
+    case GPU_SWAP:
+        vga_wait_vblank();
+        break;
+    }
+}
+
+static void core1_main()
+{
+    while (true)
+    {
+        while (queue_tail == queue_head)
+            __wfe();
+
+        const gpu_cmd_t *cmd = &queue[queue_tail % GPU_QUEUE];
+        execute(cmd);
+        done += cmd->wire;
+        __dmb();
+        queue_tail++;
+    }
+}
+
+// Parse received bytes into the queue while it has room
+static void parse()
+{
+    gpu_cmd_t cmd;
+
+    while (rx_head != rx_tail && queue_head - queue_tail < GPU_QUEUE)
+    {
+        uint8_t byte = rx[rx_tail++ % GPU_WINDOW];
+        consumed++;
+
+        int result = gpu_parse_byte(&parser, byte, &cmd);
+        if (result == GPU_PARSE_ERROR)
+        {
+            // Dropped bytes will never be drawn, count them as done so the
+            // host doesn't wait for them
+            send_error(consumed - 1, byte);
+            rejected += consumed - command_start;
+            command_start = consumed;
+        }
+        else if (result == GPU_PARSE_COMMAND)
+        {
+            command_start = consumed;
+            if (cmd.op == GPU_HELLO)
+            {
+                hello();
+                continue;
+            }
+            queue[queue_head % GPU_QUEUE] = cmd;
+            __dmb();
+            queue_head++;
+            __sev();
+        }
+    }
+}
+
+void gpu_run(void)
+{
+#ifdef GPU_UART
+    uart_init(uart1, GPU_UART_BAUD);
+    gpio_set_function(8, GPIO_FUNC_UART);
+    gpio_set_function(9, GPIO_FUNC_UART);
+#endif
+    gpu_parser_reset(&parser);
+    multicore_launch_core1(core1_main);
+
+    while (true)
+    {
+        int c;
+        while (rx_head - rx_tail < GPU_WINDOW && (c = transport_getc()) >= 0)
+            rx[rx_head++ % GPU_WINDOW] = c;
+
+        // A boot pattern makes way for the framebuffer once the host talks
+        if (rx_head != rx_tail && vga_test_pattern() != VGA_TEST_NONE)
+            vga_show_test_pattern(VGA_TEST_NONE, 0, 0);
+
+        parse();
+
+        // ACK in quarter windows while data streams in, and once the host
+        // goes quiet so it can see its last commands being drawn
+        bool idle = rx_head == rx_tail;
+        bool drained = queue_tail == queue_head;
+        if (consumed - acked_consumed >= GPU_WINDOW / 4)
+            send_ack();
+        else if (idle && (consumed != acked_consumed || done + rejected != acked_done) &&
+                 (drained || time_us_32() - last_ack_us >= ACK_INTERVAL_US))
+            send_ack();
+    }
+}
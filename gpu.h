@@ -0,0 +1,30 @@
+/**
+ * Graphics coprocessor mode
+ *
+ * The Pico draws what a host sends it over USB serial (or a UART when built
+ * with GPU_UART) using the protocol in gpu_proto.h. Core 0 receives and
+ * parses commands, core 1 draws them. host/vgagpu.hpp is the matching client.
+ *
+ * RESOURCES USED
+ *  - core 1
+ *  - uart1 on GPIO 8 (TX) and 9 (RX) with GPU_UART
+ */
+
+#ifndef GPU_H
+#define GPU_H
+
+// Number of decoded commands queued between the cores
+#define GPU_QUEUE 32
+
+// Receive buffer size, which is also the flow control window
+#define GPU_WINDOW 1024
+
+#ifndef GPU_UART_BAUD
+#define GPU_UART_BAUD 921600
+#endif
+
+// Serve commands forever. Never returning lets the demo and benchmarks drop
+// out of the link.
+void gpu_run(void) __attribute__((noreturn));
+
+#endif
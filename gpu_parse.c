@@ -0,0 +1,111 @@
+/**
+ * Command parser for the graphics coprocessor protocol, see gpu_proto.h
+ *
+ * Plain C with no SDK dependencies, it also runs in the host loopback
+ * benchmark.
+ */
+
+#include <string.h>
+#include "gpu_proto.h"
+
+static int command_length(uint8_t op)
+{
+    switch (op)
+    {
+    case GPU_NOP:
+    case GPU_HELLO:
+    case GPU_SWAP:
+        return 1;
+    case GPU_BLIT:
+        return 6;
+    case GPU_SPAN:
+    case GPU_TEXT: // without the characters
+        return 8;
+    case GPU_RECT:
+    case GPU_LINE:
+        return 10;
+    default:
+        return 0;
+    }
+}
+
+static int16_t s16(const uint8_t *p)
+{
+    return (int16_t)(p[0] | (p[1] << 8));
+}
+
+static void decode(const gpu_parser_t *p, gpu_cmd_t *cmd)
+{
+    const uint8_t *b = p->buf;
+
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->op = b[0];
+    cmd->wire = p->len;
+
+    switch (cmd->op)
+    {
+    case GPU_RECT:
+    case GPU_LINE:
+        cmd->a = s16(&b[1]);
+        cmd->b = s16(&b[3]);
+        cmd->c = s16(&b[5]);
+        cmd->d = s16(&b[7]);
+        cmd->color = b[9];
+        break;
+    case GPU_SPAN:
+        cmd->a = s16(&b[1]);
+        cmd->b = s16(&b[3]);
+        cmd->c = s16(&b[5]);
+        cmd->color = b[7];
+        break;
+    case GPU_TEXT:
+        cmd->a = s16(&b[1]);
+        cmd->b = s16(&b[3]);
+        cmd->color = b[5];
+        cmd->bg = b[6];
+        cmd->len = b[7];
+        memcpy(cmd->text, &b[8], cmd->len);
+        break;
+    case GPU_BLIT:
+        cmd->a = b[1];
+        cmd->b = s16(&b[2]);
+        cmd->c = s16(&b[4]);
+        break;
+    }
+}
+
+void gpu_parser_reset(gpu_parser_t *p)
+{
+    p->len = 0;
+    p->need = 0;
+}
+
+int gpu_parse_byte(gpu_parser_t *p, uint8_t byte, gpu_cmd_t *cmd)
+{
+    if (p->need == 0)
+    {
+        p->need = command_length(byte);
+        if (p->need == 0)
+            return GPU_PARSE_ERROR;
+    }
+
+    p->buf[p->len++] = byte;
+
+    // The text length is the last byte of the fixed part
+    if (p->buf[0] == GPU_TEXT && p->len == 8)
+    {
+        if (byte > GPU_TEXT_MAX)
+        {
+            gpu_parser_reset(p);
+            return GPU_PARSE_ERROR;
+        }
+        p->need = 8 + byte;
+    }
+
+    if (p->len < p->need)
+        return GPU_PARSE_MORE;
+
+    decode(p, cmd);
+    gpu_parser_reset(p);
+    return GPU_PARSE_COMMAND;
+}
@@ -0,0 +1,97 @@
+/**
+ * Wire format of the graphics coprocessor protocol
+ *
+ * The host sends a stream of commands, each an opcode byte followed by a
+ * fixed payload. Integers are little endian, coordinates are signed 16-bit.
+ *
+ *  NOP    0x00
+ *  HELLO  0x01                                   resets both byte counters
+ *  RECT   0x10 x y w h color                     10 bytes
+ *  SPAN   0x11 x y w color                        8 bytes
+ *  LINE   0x12 x0 y0 x1 y1 color                 10 bytes
+ *  TEXT   0x13 x y color bg n chars[n]            8 + n bytes, n <= 16
+ *  BLIT   0x14 asset x y                          6 bytes
+ *  SWAP   0x15                                    wait for vblank
+ *
+ * The device answers with
+ *
+ *  HELLO  0xa1 version window(u16) width(u16) height(u16)
+ *  ACK    0xa0 consumed(u32) done(u32)
+ *  ERROR  0xae offset(u32) opcode
+ *
+ * consumed counts command bytes the device has taken out of its receive
+ * buffer and done counts bytes of commands that have been drawn, or
+ * dropped with an ERROR, both since the last HELLO. The host may have at
+ * most window bytes that are not yet consumed; ACKs arrive without being
+ * asked for, so commands can be pipelined. A HELLO must be sent (and
+ * answered) before anything else.
+ *
+ * This header only depends on the C library so the host client shares it.
+ */
+
+#ifndef GPU_PROTO_H
+#define GPU_PROTO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GPU_VERSION 1
+
+#define GPU_NOP 0x00
+#define GPU_HELLO 0x01
+#define GPU_RECT 0x10
+#define GPU_SPAN 0x11
+#define GPU_LINE 0x12
+#define GPU_TEXT 0x13
+#define GPU_BLIT 0x14
+#define GPU_SWAP 0x15
+
+#define GPU_REPLY_ACK 0xa0
+#define GPU_REPLY_HELLO 0xa1
+#define GPU_REPLY_ERROR 0xae
+
+#define GPU_ACK_LENGTH 9
+#define GPU_HELLO_LENGTH 8
+#define GPU_ERROR_LENGTH 6
+
+#define GPU_TEXT_MAX 16
+#define GPU_COMMAND_MAX (8 + GPU_TEXT_MAX)
+
+// A decoded command
+typedef struct
+{
+    uint8_t op;
+    uint8_t color;
+    uint8_t bg;
+    uint8_t len;   // characters in text
+    int16_t a;     // x, x0 or asset
+    int16_t b;     // y or y0
+    int16_t c;     // w or x1
+    int16_t d;     // h or y1
+    uint16_t wire; // bytes the command took on the wire
+    char text[GPU_TEXT_MAX];
+} gpu_cmd_t;
+
+typedef struct
+{
+    uint8_t buf[GPU_COMMAND_MAX];
+    uint8_t len;  // bytes collected so far
+    uint8_t need; // length of the command being collected, 0 before the opcode
+} gpu_parser_t;
+
+// Result of gpu_parse_byte()
+#define GPU_PARSE_MORE 0     // command not complete yet
+#define GPU_PARSE_COMMAND 1  // *cmd holds a complete command
+#define GPU_PARSE_ERROR -1   // unknown opcode or bad length, byte dropped
+
+void gpu_parser_reset(gpu_parser_t *p);
+int gpu_parse_byte(gpu_parser_t *p, uint8_t byte, gpu_cmd_t *cmd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
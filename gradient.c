@@ -0,0 +1,215 @@
+/**
+ * Gradient fills, see gradient.h
+ */
+
+#include <stdlib.h>
+#include "gradient.h"
+#include "gfx.h"
+#include "span.h"
+
+// Fraction bits of gradient positions stepped along a row
+#define FRACTION 8
+
+const uint8_t VGA_RAM_DATA("gradient") gradient_bayer[8][8] = {
+    {0, 32, 8, 40, 2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    {3, 35, 11, 43, 1, 33, 9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+// The palette colors a gradient passes through. Position p runs from 0 to
+// end: stops[p >> 6] and stops[(p >> 6) + 1] mixed (p & 63) in 64.
+typedef struct
+{
+    uint8_t stops[5];
+    int end;
+} ramp_t;
+
+static void make_ramp(ramp_t *r, char c0, char c1)
+{
+    int a[3] = {VGA_RED(c0), VGA_GREEN(c0), VGA_BLUE(c0)};
+    int b[3] = {VGA_RED(c1), VGA_GREEN(c1), VGA_BLUE(c1)};
+    int n = 1;
+
+    // One step per level of the channel that changes most
+    for (int c = 0; c < 3; c++)
+        if (abs(b[c] - a[c]) > n)
+            n = abs(b[c] - a[c]);
+
+    for (int k = 0; k <= n; k++)
+    {
+        int v[3];
+        for (int c = 0; c < 3; c++)
+            v[c] = (2 * (a[c] * n + (b[c] - a[c]) * k) + n) / (2 * n);
+        r->stops[k] = VGA_RGB(v[0], v[1], v[2]);
+    }
+    r->stops[n + 1] = r->stops[n];
+    r->end = n * 64;
+}
+
+static inline uint32_t ramp_pixel(const ramp_t *r, int p, int threshold)
+{
+    return (p & 63) > threshold ? r->stops[(p >> 6) + 1] : r->stops[p >> 6];
+}
+
+// Entries of the table from squared distance to ramp position
+#define RADIAL_TABLE 1024
+
+// Largest radius, so that the table can be built in 32 bits
+#define RADIAL_MAX 4095
+
+// Static to keep it off core 0's small stack, so radial fills are not
+// reentrant
+static uint8_t radial_table[RADIAL_TABLE];
+
+// Store word i of a row, built in screen word order, keeping the pixels
+// outside x0..x1
+static inline void put_word(uint32_t *dst, int i, int x0, int x1, uint32_t word)
+{
+    int first = i == x0 / 5 ? x0 % 5 : 0;
+    int last = i == x1 / 5 ? x1 % 5 : 4;
+
+    if (first == 0 && last == 4)
+        dst[i] = word;
+    else
+        vga_put_masked(&dst[i], word, VGA_SPAN_MASK(first, last));
+}
+
+// Ramp position (in 1 << FRACTION) along a row, clamped to the ends
+static inline int clamp_position(int p, int end)
+{
+    return p < 0 ? 0 : p > end ? end : p;
+}
+
+void VGA_RAM_FUNC(fillLinearGradient)(int x, int y, int w, int h, int x0, int y0, char c0, int x1, int y1, char c1)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+
+    ramp_t r;
+    make_ramp(&r, c0, c1);
+
+    int vx = x1 - x0, vy = y1 - y0;
+    int64_t len2 = (int64_t)vx * vx + (int64_t)vy * vy;
+    if (len2 == 0)
+        len2 = 1;
+
+    // Ramp position at the left of each row, exact, and the per pixel step.
+    // The step is at most r.end << FRACTION, so 640 of them fit in an int
+    // with room to spare.
+    int end = r.end << FRACTION;
+    int step = ((int64_t)vx * end) / len2;
+    int w0 = x / 5, w1 = (x + w - 1) / 5;
+
+    for (int row = y; row < y + h; row++)
+    {
+        int64_t start = ((int64_t)(x - x0) * vx + (int64_t)(row - y0) * vy) * end / len2;
+        const uint8_t *t = gradient_bayer[row & 7];
+
+        if (vx == 0)
+        {
+            // Same position along the whole row: one tile of 8 words
+            int p = clamp_position(start, end) >> FRACTION;
+            uint32_t tile[8];
+            for (int i = 0; i < 8; i++)
+            {
+                uint32_t word = 0;
+                for (int k = 0; k < 5; k++)
+                    word = (word << 6) | ramp_pixel(&r, p, t[(i * 5 + k) & 7]);
+                tile[i] = word;
+            }
+            fillSpanTile(x, row, w, tile);
+            continue;
+        }
+
+        // Keep the running position where the clamp gives the same result
+        // but it can't overflow
+        int margin = abs(step) * VGA_WIDTH;
+        int p = start < -margin ? -margin : start > end + margin ? end + margin : start;
+        p -= step * (x - w0 * 5);
+
+        uint32_t *dst = vga_row(row);
+        for (int i = w0; i <= w1; i++)
+        {
+            uint32_t word = 0;
+            for (int k = 0; k < 5; k++, p += step)
+                word = (word << 6) | ramp_pixel(&r, clamp_position(p, end) >> FRACTION, t[(i * 5 + k) & 7]);
+            put_word(dst, i, x, x + w - 1, word);
+        }
+    }
+}
+
+// Integer square root
+static uint32_t isqrt(uint32_t v)
+{
+    uint32_t root = 0, bit = 1u << 30;
+
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
+    {
+        if (v >= root + bit)
+        {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+    return root;
+}
+
+void VGA_RAM_FUNC(fillRadialGradient)(int x, int y, int w, int h, int cx, int cy, int r, char c0, char c1)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+    if (r < 1)
+        r = 1;
+    if (r > RADIAL_MAX)
+        r = RADIAL_MAX;
+
+    ramp_t ramp;
+    make_ramp(&ramp, c0, c1);
+
+    // The squared distance shifted right by shift indexes a table of ramp
+    // positions, which saves a square root per pixel
+    uint32_t r2 = (uint32_t)r * r;
+    int shift = 0;
+    while ((r2 >> shift) >= RADIAL_TABLE)
+        shift++;
+    int n = (r2 >> shift) + 1;
+    for (int i = 0; i < n; i++)
+    {
+        int p = ramp.end * isqrt((uint32_t)i << (shift + 8)) / (r * 16);
+        radial_table[i] = p > ramp.end ? ramp.end : p;
+    }
+
+    int w0 = x / 5, w1 = (x + w - 1) / 5;
+
+    for (int row = y; row < y + h; row++)
+    {
+        const uint8_t *t = gradient_bayer[row & 7];
+        uint32_t *dst = vga_row(row);
+        int dx = w0 * 5 - cx;
+        uint32_t d2 = dx * dx + (row - cy) * (row - cy);
+
+        for (int i = w0; i <= w1; i++)
+        {
+            uint32_t word = 0;
+            for (int k = 0; k < 5; k++)
+            {
+                uint32_t index = d2 >> shift;
+                int p = index < (uint32_t)n ? radial_table[index] : ramp.end;
+                word = (word << 6) | ramp_pixel(&ramp, p, t[(i * 5 + k) & 7]);
+                d2 += 2 * dx + 1;
+                dx++;
+            }
+            put_word(dst, i, x, x + w - 1, word);
+        }
+    }
+}
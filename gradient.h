@@ -0,0 +1,32 @@
+/**
+ * Dithered gradient fills
+ *
+ * A gradient runs from color c0 to color c1 through the palette colors in
+ * between: black to white passes the two grays, for example. Between two
+ * neighboring colors the mix is an 8x8 ordered dither anchored to the
+ * screen, so 64 shades fit between every pair.
+ *
+ *  fillLinearGradient  c0 at (x0, y0), c1 at (x1, y1), constant along
+ *                      lines at right angles to the one between them
+ *  fillRadialGradient  c0 at (cx, cy), c1 at distance r (up to 4095) and
+ *                      beyond
+ *
+ * Only the w x h rectangle at (x, y) is drawn, clipped to the screen. Rows
+ * are built a word at a time straight into the screen; rows of a vertical
+ * gradient are a single dither row and go through fillSpanTile(). The
+ * radius table is static, so only one core at a time may draw radial
+ * gradients.
+ */
+
+#ifndef GRADIENT_H
+#define GRADIENT_H
+
+#include "vga.h"
+
+void fillLinearGradient(int x, int y, int w, int h, int x0, int y0, char c0, int x1, int y1, char c1);
+void fillRadialGradient(int x, int y, int w, int h, int cx, int cy, int r, char c0, char c1);
+
+// 8x8 ordered dither thresholds, 0-63
+extern const uint8_t gradient_bayer[8][8];
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * Speed and output of the RGB888 to 64-color conversion in rgb.c
+ *
+ * Converts a whole image with each dither mode, reports Mpixel/s and
+ * optionally writes what the screen would show as binary PPMs. Without an
+ * input image a 640x480 test card of gradients is used.
+ *
+ * BUILD
+ *  gcc -O2 -c ../rgb.c
+ *  g++ -O2 -std=c++17 -o rgbconv_bench rgbconv_bench.cpp rgb.o
+ *
+ * USE
+ *  rgbconv_bench [image.ppm] [-o prefix]   writes prefix-none.ppm etc.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../rgb.h"
+}
+
+namespace {
+
+struct Image {
+    int width = 0, height = 0;
+    std::vector<uint8_t> rgb;
+};
+
+// Horizontal hue and vertical brightness ramps, the hardest case for 4 levels
+Image test_card()
+{
+    Image img;
+    img.width = 640;
+    img.height = 480;
+    img.rgb.resize(size_t(img.width) * img.height * 3);
+    for (int y = 0; y < img.height; y++) {
+        for (int x = 0; x < img.width; x++) {
+            uint8_t *p = &img.rgb[(size_t(y) * img.width + x) * 3];
+            int band = y * 4 / img.height;
+            int v = x * 255 / (img.width - 1);
+            p[0] = band == 0 || band == 3 ? v : 0;
+            p[1] = band == 1 || band == 3 ? v : 0;
+            p[2] = band == 2 || band == 3 ? v : (255 - v) * (y % 120) / 120;
+        }
+    }
+    return img;
+}
+
+// Binary PPM with maxval 255
+Image read_ppm(const char *path)
+{
+    FILE *f = std::fopen(path, "rb");
+    if (!f)
+        throw std::runtime_error(std::string("cannot open ") + path);
+    Image img;
+    int maxval = 0;
+    if (std::fscanf(f, "P6 %d %d %d", &img.width, &img.height, &maxval) != 3 || maxval != 255 ||
+        std::fgetc(f) == EOF) {
+        std::fclose(f);
+        throw std::runtime_error(std::string(path) + " is not a binary PPM with maxval 255");
+    }
+    img.rgb.resize(size_t(img.width) * img.height * 3);
+    size_t n = std::fread(img.rgb.data(), 1, img.rgb.size(), f);
+    std::fclose(f);
+    if (n != img.rgb.size())
+        throw std::runtime_error(std::string(path) + " is truncated");
+    return img;
+}
+
+void write_ppm(const std::string &path, int width, int height, const std::vector<uint32_t> &words)
+{
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        throw std::runtime_error("cannot create " + path);
+    int stride = (width + VGA_PIXELS_PER_WORD - 1) / VGA_PIXELS_PER_WORD;
+    std::fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int c = (words[size_t(y) * stride + x / VGA_PIXELS_PER_WORD] >> VGA_PIXEL_SHIFT(x % VGA_PIXELS_PER_WORD)) &
+                    VGA_PIXEL_MASK;
+            uint8_t p[3] = {uint8_t(VGA_LEVEL(VGA_RED(c))), uint8_t(VGA_LEVEL(VGA_GREEN(c))),
+                            uint8_t(VGA_LEVEL(VGA_BLUE(c)))};
+            std::fwrite(p, 1, 3, f);
+        }
+    }
+    std::fclose(f);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *input = nullptr;
+    std::string prefix;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            prefix = argv[++i];
+        else
+            input = argv[i];
+    }
+
+    try {
+        Image img = input ? read_ppm(input) : test_card();
+        int stride = (img.width + VGA_PIXELS_PER_WORD - 1) / VGA_PIXELS_PER_WORD;
+        std::vector<uint32_t> words(size_t(stride) * img.height);
+        std::vector<int16_t> errors(RGB_ERRORS(img.width));
+        static const char *names[] = {"none", "ordered", "diffuse"};
+
+        std::printf("%dx%d %s\n", img.width, img.height, input ? input : "test card");
+        for (int dither = RGB_DITHER_NONE; dither <= RGB_DITHER_DIFFUSE; dither++) {
+            // Whole images until at least half a second has passed
+            long images = 0;
+            double s;
+            auto start = std::chrono::steady_clock::now();
+            do {
+                std::fill(errors.begin(), errors.end(), 0);
+                for (int y = 0; y < img.height; y++)
+                    rgb_convert_row(&img.rgb[size_t(y) * img.width * 3], img.width, 0, y, dither, errors.data(),
+                                    &words[size_t(y) * stride]);
+                images++;
+                s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            } while (s < 0.5);
+
+            std::printf("  %-8s %8.1f Mpixel/s\n", names[dither], double(images) * img.width * img.height / s / 1e6);
+            if (!prefix.empty())
+                write_ppm(prefix + "-" + names[dither] + ".ppm", img.width, img.height, words);
+        }
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "rgbconv_bench: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * Host side of the framebuffer capture (see capture.h for the stream format)
+ *
+ * Requests a screenshot from the Pico over USB serial, or decodes a stream
+ * saved earlier, and writes it as a binary PPM.
+ *
+ * BUILD
+ *  g++ -O2 -std=c++17 -o vgacap vgacap.cpp
+ *
+ * USE
+ *  vgacap /dev/ttyACM0 screen.ppm     capture from a running board
+ *  vgacap capture.bin screen.ppm      decode a saved stream ('-' for stdin)
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../pixel.h"
+
+namespace {
+
+class Input {
+public:
+    explicit Input(const char *path)
+    {
+        if (std::strcmp(path, "-") == 0) {
+            fd_ = STDIN_FILENO;
+            return;
+        }
+        fd_ = open(path, O_RDWR | O_NOCTTY);
+        if (fd_ < 0)
+            fd_ = open(path, O_RDONLY);
+        if (fd_ < 0)
+            throw std::runtime_error(std::string("cannot open ") + path);
+        if (isatty(fd_)) {
+            termios tio;
+            tcgetattr(fd_, &tio);
+            cfmakeraw(&tio);
+            tcsetattr(fd_, TCSANOW, &tio);
+            tcflush(fd_, TCIOFLUSH);
+            if (write(fd_, "c", 1) != 1)
+                throw std::runtime_error("cannot send capture command");
+        }
+    }
+
+    ~Input()
+    {
+        if (fd_ != STDIN_FILENO)
+            close(fd_);
+    }
+
+    uint8_t byte()
+    {
+        if (pos_ == len_) {
+            ssize_t n = read(fd_, buf_, sizeof(buf_));
+            if (n <= 0)
+                throw std::runtime_error("stream ended early");
+            len_ = n;
+            pos_ = 0;
+        }
+        return buf_[pos_++];
+    }
+
+    uint16_t u16()
+    {
+        uint16_t lo = byte();
+        return lo | (byte() << 8);
+    }
+
+    uint32_t u32()
+    {
+        uint32_t lo = u16();
+        return lo | (uint32_t(u16()) << 16);
+    }
+
+    // Skip anything printed before the capture started
+    void sync(const char *magic)
+    {
+        size_t matched = 0;
+        while (magic[matched]) {
+            uint8_t b = byte();
+            if (b == uint8_t(magic[matched]))
+                matched++;
+            else
+                matched = b == uint8_t(magic[0]) ? 1 : 0;
+        }
+    }
+
+    void expect(const char *magic)
+    {
+        for (const char *p = magic; *p; p++)
+            if (byte() != uint8_t(*p))
+                throw std::runtime_error(std::string("missing ") + magic);
+    }
+
+private:
+    int fd_;
+    uint8_t buf_[4096];
+    size_t pos_ = 0;
+    size_t len_ = 0;
+};
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <serial device | capture file | -> <out.ppm>\n", argv[0]);
+        return 2;
+    }
+
+    try {
+        Input in(argv[1]);
+        auto start = std::chrono::steady_clock::now();
+
+        in.sync("VGAC");
+        unsigned version = in.byte();
+        unsigned format = in.byte();
+        unsigned width = in.u16();
+        unsigned height = in.u16();
+        unsigned line_words = in.u16();
+        if (version != 1 || format != 0 || line_words * VGA_PIXELS_PER_WORD < width)
+            throw std::runtime_error("unsupported capture stream");
+
+        std::vector<uint32_t> words(size_t(line_words) * height);
+        for (unsigned y = 0; y < height; y++) {
+            uint32_t *line = &words[size_t(y) * line_words];
+            unsigned i = 0;
+            while (i < line_words) {
+                uint8_t token = in.byte();
+                unsigned n;
+                if (token < 0x40) {
+                    n = token + 1;
+                    if (i + n > line_words)
+                        throw std::runtime_error("corrupt literal run");
+                    for (unsigned k = 0; k < n; k++)
+                        line[i + k] = in.u32();
+                } else if (token < 0x80) {
+                    n = token - 0x40 + 2;
+                    if (i + n > line_words)
+                        throw std::runtime_error("corrupt repeat run");
+                    uint32_t w = in.u32();
+                    for (unsigned k = 0; k < n; k++)
+                        line[i + k] = w;
+                } else {
+                    n = token - 0x80 + 1;
+                    if (y == 0 || i + n > line_words)
+                        throw std::runtime_error("corrupt copy run");
+                    std::memcpy(&line[i], line - line_words + i, n * sizeof(uint32_t));
+                }
+                i += n;
+            }
+        }
+
+        in.expect("VEND");
+        uint32_t count = in.u32();
+        uint32_t sum = in.u32();
+        uint32_t body = in.u32();
+        uint32_t encode_us = in.u32();
+        uint32_t transfer_us = in.u32();
+        double host_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        uint32_t check = 0;
+        for (uint32_t w : words)
+            check += w;
+        if (count != words.size() || check != sum)
+            throw std::runtime_error("checksum mismatch");
+
+        FILE *out = std::fopen(argv[2], "wb");
+        if (!out)
+            throw std::runtime_error(std::string("cannot create ") + argv[2]);
+        std::fprintf(out, "P6\n%u %u\n255\n", width, height);
+        std::vector<uint8_t> row(width * 3);
+        for (unsigned y = 0; y < height; y++) {
+            for (unsigned x = 0; x < width; x++) {
+                uint32_t w = words[size_t(y) * line_words + x / VGA_PIXELS_PER_WORD];
+                unsigned c = (w >> VGA_PIXEL_SHIFT(x % VGA_PIXELS_PER_WORD)) & VGA_PIXEL_MASK;
+                row[x * 3 + 0] = VGA_LEVEL(VGA_RED(c));
+                row[x * 3 + 1] = VGA_LEVEL(VGA_GREEN(c));
+                row[x * 3 + 2] = VGA_LEVEL(VGA_BLUE(c));
+            }
+            std::fwrite(row.data(), 1, row.size(), out);
+        }
+        std::fclose(out);
+
+        size_t raw = words.size() * sizeof(uint32_t);
+        std::printf("%ux%u, %zu raw bytes, %u compressed (%.1f%%)\n", width, height, raw, body, 100.0 * body / raw);
+        std::printf("capture stall %.1f ms (compress %.1f ms, send %.1f ms), host receive %.1f ms\n",
+                    (encode_us + transfer_us) / 1000.0, encode_us / 1000.0, transfer_us / 1000.0, host_ms);
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "vgacap: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
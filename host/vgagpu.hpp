@@ -0,0 +1,277 @@
+/**
+ * Host client for the graphics coprocessor protocol (see gpu_proto.h)
+ *
+ * Commands are batched and written when the batch fills up or on flush().
+ * The client keeps no more than the device's window of bytes unconsumed and
+ * reads ACKs as they arrive, so commands are pipelined without waiting for
+ * each one to be drawn.
+ *
+ *  int fd = open("/dev/ttyACM0", O_RDWR | O_NOCTTY);
+ *  vgagpu::Client gpu(fd);
+ *  gpu.hello();
+ *  gpu.rect(0, 0, 640, 480, VGA_RGB(0, 0, 1));
+ *  gpu.text(8, 8, "hello", VGA_RGB(3, 3, 3), VGA_RGB(0, 0, 1));
+ *  gpu.swap();
+ *  gpu.finish();
+ *
+ * Header only, needs a POSIX system.
+ */
+
+#ifndef VGAGPU_HPP
+#define VGAGPU_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../gpu_proto.h"
+#include "../pixel.h"
+
+namespace vgagpu {
+
+class Client {
+public:
+    // fd must be open for reading and writing. Terminals are put in raw mode.
+    explicit Client(int fd, size_t batch = 512) : fd_(fd), batch_limit_(batch)
+    {
+        if (isatty(fd_)) {
+            termios tio;
+            tcgetattr(fd_, &tio);
+            cfmakeraw(&tio);
+            tcsetattr(fd_, TCSANOW, &tio);
+        }
+    }
+
+    // Reset the device's counters and learn its window. Must come first.
+    void hello(int timeout_ms = 2000)
+    {
+        batch_.clear();
+        uint8_t op = GPU_HELLO;
+        write_all(&op, 1);
+        window_ = 0;
+        while (window_ == 0)
+            if (!read_replies(timeout_ms))
+                throw std::runtime_error("no HELLO reply");
+        sent_ = consumed_ = done_ = 0;
+    }
+
+    void rect(int x, int y, int w, int h, uint8_t color)
+    {
+        begin(GPU_RECT, 10);
+        put16(x);
+        put16(y);
+        put16(w);
+        put16(h);
+        put8(color);
+        commands_++;
+    }
+
+    void span(int x, int y, int w, uint8_t color)
+    {
+        begin(GPU_SPAN, 8);
+        put16(x);
+        put16(y);
+        put16(w);
+        put8(color);
+        commands_++;
+    }
+
+    void line(int x0, int y0, int x1, int y1, uint8_t color)
+    {
+        begin(GPU_LINE, 10);
+        put16(x0);
+        put16(y0);
+        put16(x1);
+        put16(y1);
+        put8(color);
+        commands_++;
+    }
+
+    // Long strings go out as several TEXT commands
+    void text(int x, int y, const std::string &s, uint8_t color, uint8_t bg, int char_width = 6)
+    {
+        for (size_t pos = 0; pos < s.size(); pos += GPU_TEXT_MAX) {
+            size_t n = std::min<size_t>(GPU_TEXT_MAX, s.size() - pos);
+            begin(GPU_TEXT, 8 + n);
+            put16(x + int(pos) * char_width);
+            put16(y);
+            put8(color);
+            put8(bg);
+            put8(n);
+            batch_.insert(batch_.end(), s.begin() + pos, s.begin() + pos + n);
+            commands_++;
+        }
+    }
+
+    void blit(uint8_t asset, int x, int y)
+    {
+        begin(GPU_BLIT, 6);
+        put8(asset);
+        put16(x);
+        put16(y);
+        commands_++;
+    }
+
+    // Wait for vblank on the device
+    void swap()
+    {
+        begin(GPU_SWAP, 1);
+        commands_++;
+    }
+
+    // Queue bytes as they are, e.g. to see how the device handles bad input
+    void raw(const uint8_t *p, size_t n)
+    {
+        if (batch_.size() + n > batch_limit_)
+            flush();
+        batch_.insert(batch_.end(), p, p + n);
+    }
+
+    // Send everything batched so far, blocking only for flow control
+    void flush()
+    {
+        size_t pos = 0;
+        while (pos < batch_.size()) {
+            read_replies(0);
+            uint32_t in_flight = sent_ - consumed_;
+            if (in_flight >= window_) {
+                if (!read_replies(1000))
+                    throw std::runtime_error("device stopped acknowledging");
+                continue;
+            }
+            size_t n = std::min<size_t>(window_ - in_flight, batch_.size() - pos);
+            ssize_t w = ::write(fd_, &batch_[pos], n);
+            if (w < 0) {
+                if (errno == EINTR || errno == EAGAIN)
+                    continue;
+                throw std::runtime_error(std::string("write: ") + std::strerror(errno));
+            }
+            pos += w;
+            sent_ += w;
+        }
+        batch_.clear();
+    }
+
+    // Flush and wait until the device has drawn everything
+    void finish(int timeout_ms = 5000)
+    {
+        flush();
+        while (done_ != sent_)
+            if (!read_replies(timeout_ms))
+                throw std::runtime_error("timed out waiting for the device");
+    }
+
+    uint32_t sent() const { return sent_; }
+    uint32_t done() const { return done_; }
+    uint16_t window() const { return window_; }
+    uint64_t commands() const { return commands_; }
+    uint64_t acks() const { return acks_; }
+    uint64_t errors() const { return errors_; }
+
+private:
+    void begin(uint8_t op, size_t len)
+    {
+        if (batch_.size() + len > batch_limit_)
+            flush();
+        batch_.push_back(op);
+    }
+
+    void put8(unsigned v)
+    {
+        batch_.push_back(uint8_t(v));
+    }
+
+    void put16(int v)
+    {
+        batch_.push_back(uint8_t(v));
+        batch_.push_back(uint8_t(v >> 8));
+    }
+
+    void write_all(const uint8_t *p, size_t n)
+    {
+        while (n > 0) {
+            ssize_t w = ::write(fd_, p, n);
+            if (w < 0) {
+                if (errno == EINTR || errno == EAGAIN)
+                    continue;
+                throw std::runtime_error(std::string("write: ") + std::strerror(errno));
+            }
+            p += w;
+            n -= w;
+        }
+    }
+
+    static uint32_t u32(const uint8_t *p)
+    {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    // Read and handle whatever replies are available, waiting up to
+    // timeout_ms for the first one. Returns false on timeout.
+    bool read_replies(int timeout_ms)
+    {
+        pollfd pfd = {fd_, POLLIN, 0};
+        if (poll(&pfd, 1, timeout_ms) <= 0)
+            return false;
+
+        uint8_t buf[512];
+        ssize_t n = ::read(fd_, buf, sizeof(buf));
+        if (n <= 0)
+            return false;
+        rx_.insert(rx_.end(), buf, buf + n);
+
+        size_t pos = 0;
+        while (pos < rx_.size()) {
+            const uint8_t *p = &rx_[pos];
+            size_t left = rx_.size() - pos;
+            if (p[0] == GPU_REPLY_ACK) {
+                if (left < GPU_ACK_LENGTH)
+                    break;
+                consumed_ = u32(p + 1);
+                done_ = u32(p + 5);
+                acks_++;
+                pos += GPU_ACK_LENGTH;
+            } else if (p[0] == GPU_REPLY_HELLO) {
+                if (left < GPU_HELLO_LENGTH)
+                    break;
+                if (p[1] != GPU_VERSION)
+                    throw std::runtime_error("unsupported protocol version");
+                window_ = p[2] | (p[3] << 8);
+                pos += GPU_HELLO_LENGTH;
+            } else if (p[0] == GPU_REPLY_ERROR) {
+                if (left < GPU_ERROR_LENGTH)
+                    break;
+                errors_++;
+                pos += GPU_ERROR_LENGTH;
+            } else {
+                pos++; // not a reply, e.g. text printed before the handshake
+            }
+        }
+        rx_.erase(rx_.begin(), rx_.begin() + pos);
+        return true;
+    }
+
+    int fd_;
+    size_t batch_limit_;
+    std::vector<uint8_t> batch_;
+    std::vector<uint8_t> rx_;
+    uint32_t sent_ = 0;
+    uint32_t consumed_ = 0;
+    uint32_t done_ = 0;
+    uint16_t window_ = 0;
+    uint64_t commands_ = 0;
+    uint64_t acks_ = 0;
+    uint64_t errors_ = 0;
+};
+
+} // namespace vgagpu
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * Throughput benchmark for the graphics coprocessor protocol
+ *
+ * Without arguments a stand-in device runs in a thread on the other end of a
+ * pseudo terminal. It uses the firmware's parser (gpu_parse.c) and the same
+ * receive window and ACK rules as gpu.c but does not draw, so the numbers are
+ * the protocol and client overhead. Pass a serial device to measure a board
+ * running the gpu firmware instead.
+ *
+ * BUILD
+ *  gcc -O2 -c ../gpu_parse.c
+ *  g++ -O2 -std=c++17 -o vgagpu_bench vgagpu_bench.cpp gpu_parse.o -lpthread
+ *
+ * USE
+ *  vgagpu_bench [/dev/ttyACM0] [commands]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+
+#include "vgagpu.hpp"
+
+namespace {
+
+// Must match gpu.h
+constexpr uint32_t window = 1024;
+
+void put32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        p[i] = uint8_t(v >> (8 * i));
+}
+
+void write_all(int fd, const uint8_t *p, size_t n)
+{
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w <= 0)
+            return;
+        p += w;
+        n -= w;
+    }
+}
+
+// Parses everything it reads and ACKs like the firmware does
+void stand_in(int fd, std::atomic<bool> &stop)
+{
+    gpu_parser_t parser;
+    gpu_cmd_t cmd;
+    uint32_t consumed = 0, done = 0, acked_consumed = 0, acked_done = 0;
+    uint32_t command_start = 0;
+    uint8_t buf[window];
+
+    gpu_parser_reset(&parser);
+    while (!stop) {
+        pollfd pfd = {fd, POLLIN, 0};
+        bool idle = poll(&pfd, 1, 10) <= 0;
+        if (!idle) {
+            ssize_t n = read(fd, buf, sizeof(buf));
+            if (n <= 0)
+                break;
+            for (ssize_t i = 0; i < n; i++) {
+                consumed++;
+                int r = gpu_parse_byte(&parser, buf[i], &cmd);
+                if (r == GPU_PARSE_ERROR) {
+                    uint8_t reply[GPU_ERROR_LENGTH] = {GPU_REPLY_ERROR};
+                    put32(&reply[1], consumed - 1);
+                    reply[5] = buf[i];
+                    write_all(fd, reply, sizeof(reply));
+                    done += consumed - command_start;
+                    command_start = consumed;
+                } else if (r == GPU_PARSE_COMMAND && cmd.op == GPU_HELLO) {
+                    consumed = done = acked_consumed = acked_done = command_start = 0;
+                    uint8_t reply[GPU_HELLO_LENGTH] = {GPU_REPLY_HELLO, GPU_VERSION,
+                                                       uint8_t(window), uint8_t(window >> 8), 640 & 0xff, 640 >> 8, 480 & 0xff, 480 >> 8};
+                    write_all(fd, reply, sizeof(reply));
+                } else if (r == GPU_PARSE_COMMAND) {
+                    done += cmd.wire;
+                    command_start = consumed;
+                }
+
+                if (consumed - acked_consumed >= window / 4) {
+                    uint8_t reply[GPU_ACK_LENGTH] = {GPU_REPLY_ACK};
+                    put32(&reply[1], acked_consumed = consumed);
+                    put32(&reply[5], acked_done = done);
+                    write_all(fd, reply, sizeof(reply));
+                }
+            }
+        } else if (consumed != acked_consumed || done != acked_done) {
+            uint8_t reply[GPU_ACK_LENGTH] = {GPU_REPLY_ACK};
+            put32(&reply[1], acked_consumed = consumed);
+            put32(&reply[5], acked_done = done);
+            write_all(fd, reply, sizeof(reply));
+        }
+    }
+}
+
+// Bad commands must be reported and counted as done, or finish() would wait
+// for them forever
+void check_errors(vgagpu::Client &gpu)
+{
+    const uint8_t bad_opcode[] = {0xff};
+    const uint8_t bad_text[] = {GPU_TEXT, 0, 0, 0, 0, 0, 0, GPU_TEXT_MAX + 1};
+    uint64_t errors = gpu.errors();
+
+    gpu.rect(0, 0, 8, 8, 0);
+    gpu.raw(bad_opcode, sizeof(bad_opcode));
+    gpu.raw(bad_text, sizeof(bad_text));
+    gpu.swap();
+    gpu.finish(1000);
+    if (gpu.errors() - errors != 2)
+        throw std::runtime_error("expected 2 errors, got " + std::to_string(gpu.errors() - errors));
+}
+
+// A dashboard-like mix of commands
+void workload(vgagpu::Client &gpu, long commands)
+{
+    long n = 0;
+    while (n < commands) {
+        int i = int(n % 400);
+        gpu.rect(i, i % 480, 40, 20, uint8_t(n));
+        gpu.span(0, i % 480, 640, uint8_t(n + 1));
+        gpu.line(0, 0, 639 - i, 479, uint8_t(n + 2));
+        gpu.text(8, 8 + (i % 58) * 8, "T=" + std::to_string(n), VGA_RGB(3, 3, 3), 0);
+        gpu.blit(uint8_t(n & 1), i, 100);
+        n += 5;
+        if (n % 500 == 0) {
+            gpu.swap();
+            n++;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string device;
+    long commands = 200000;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '/')
+            device = argv[i];
+        else
+            commands = std::atol(argv[i]);
+    }
+
+    int fd;
+    int device_fd = -1;
+    std::atomic<bool> stop{false};
+    std::thread device_thread;
+
+    if (device.empty()) {
+        device_fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (device_fd < 0 || grantpt(device_fd) || unlockpt(device_fd)) {
+            std::perror("posix_openpt");
+            return 1;
+        }
+        fd = open(ptsname(device_fd), O_RDWR | O_NOCTTY);
+        termios tio;
+        tcgetattr(device_fd, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(device_fd, TCSANOW, &tio);
+        device_thread = std::thread(stand_in, device_fd, std::ref(stop));
+    } else {
+        fd = open(device.c_str(), O_RDWR | O_NOCTTY);
+    }
+    if (fd < 0) {
+        std::perror("open");
+        return 1;
+    }
+
+    try {
+        vgagpu::Client gpu(fd);
+        gpu.hello();
+        check_errors(gpu);
+
+        auto start = std::chrono::steady_clock::now();
+        workload(gpu, commands);
+        gpu.finish();
+        double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%s: %llu commands, %u bytes in %.3f s\n", device.empty() ? "loopback" : device.c_str(),
+                    (unsigned long long)gpu.commands(), gpu.sent(), s);
+        std::printf("%.0f commands/s, %.2f bytes/command, %.0f KB/s, %llu acks, %llu errors\n",
+                    gpu.commands() / s, double(gpu.sent()) / gpu.commands(), gpu.sent() / s / 1024,
+                    (unsigned long long)gpu.acks(), (unsigned long long)gpu.errors());
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "vgagpu_bench: %s\n", e.what());
+        stop = true;
+        if (device_thread.joinable())
+            device_thread.join();
+        return 1;
+    }
+
+    stop = true;
+    if (device_thread.joinable())
+        device_thread.join();
+    close(fd);
+    if (device_fd >= 0)
+        close(device_fd);
+    return 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * Packed pixel format shared by the firmware and the host tools
+ *
+ * vga_data_array holds 5 pixels per 32-bit word, 6 bits each. Pixel 0 of a
+ * word sits in bits 24-29 and pixel 4 in bits 0-5; bits 30 and 31 are unused.
+ *
+ * Each color channel is a 2-bit resistor DAC. The 390 ohm resistor is on the
+ * lower GPIO of each pair and carries the most significant bit, so inside a
+ * 6-bit pixel the channels are stored MSB first:
+ *  - bit 0 ---> red MSB,   bit 1 ---> red LSB
+ *  - bit 2 ---> green MSB, bit 3 ---> green LSB
+ *  - bit 4 ---> blue MSB,  bit 5 ---> blue LSB
+ * Use VGA_RGB() to build a pixel value from 0-3 channel intensities.
+ *
+ * This header only depends on the C library so it can be included from host
+ * code as well.
+ */
+
+#ifndef PIXEL_H
+#define PIXEL_H
+
+#include <stdint.h>
+
+#define VGA_PIXELS_PER_WORD 5
+#define VGA_BITS_PER_PIXEL 6
+#define VGA_PIXEL_MASK 0x3f
+#define VGA_WORD_MASK 0x3fffffff
+
+// Bit offset of pixel i (0-4) inside a packed word
+#define VGA_PIXEL_SHIFT(i) (24 - ((i) * VGA_BITS_PER_PIXEL))
+
+// A word with all 5 pixels set to color c
+#define VGA_SOLID(c) ((uint32_t)(c) * 0x01041041u)
+
+// Mask covering pixels first..last (0-4, inclusive) of a word
+#define VGA_SPAN_MASK(first, last) ((VGA_WORD_MASK >> ((first) * VGA_BITS_PER_PIXEL)) & ~((1u << VGA_PIXEL_SHIFT(last)) - 1))
+
+// Swap the two bits of a channel (the operation is its own inverse)
+#define VGA_CHANNEL_BITS(v) ((((v) & 1) << 1) | (((v) >> 1) & 1))
+
+// Build a pixel from red, green and blue intensities (0-3 each)
+#define VGA_RGB(r, g, b) (VGA_CHANNEL_BITS(r) | (VGA_CHANNEL_BITS(g) << 2) | (VGA_CHANNEL_BITS(b) << 4))
+
+// Channel intensities (0-3) of a pixel
+#define VGA_RED(c) VGA_CHANNEL_BITS((c) & 3)
+#define VGA_GREEN(c) VGA_CHANNEL_BITS(((c) >> 2) & 3)
+#define VGA_BLUE(c) VGA_CHANNEL_BITS(((c) >> 4) & 3)
+
+// Approximate 8-bit brightness of each DAC level. With 390 ohm and 1K into
+// the monitor's 75 ohm termination the levels are 0, 28%, 72% and 100% of
+// the 0.7V full scale rather than evenly spaced.
+#define VGA_LEVEL(v) ((v) == 0 ? 0 : (v) == 1 ? 71 : (v) == 2 ? 184 : 255)
+
+#endif
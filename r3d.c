@@ -0,0 +1,297 @@
+/**
+ * Flat shaded 3D models, split across both cores, see r3d.h
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "pico/multicore.h"
+#include "gfx.h"
+#include "r3d.h"
+
+// Fraction bits of the rotation matrix
+#define FRACTION 14
+
+// Closest a vertex may come to the viewer, in model units. Faces with a
+// vertex nearer than that are left out.
+#define NEAR 16
+
+// Depth buckets faces are sorted into
+#define BUCKETS 64
+
+// Light on faces turned away from it, out of 256
+#define AMBIENT 72
+
+static const r3d_vertex_t cube_vertices[] = {
+    {-64, -64, -64}, {64, -64, -64}, {64, 64, -64}, {-64, 64, -64},
+    {-64, -64, 64},  {64, -64, 64},  {64, 64, 64},  {-64, 64, 64},
+};
+
+static const uint8_t cube_faces[][3] = {
+    {1, 2, 6}, {1, 6, 5}, {0, 7, 3}, {0, 4, 7}, {3, 7, 6}, {3, 6, 2},
+    {0, 5, 4}, {0, 1, 5}, {4, 5, 6}, {4, 6, 7}, {0, 2, 1}, {0, 3, 2},
+};
+
+static const char cube_colors[] = {
+    VGA_RGB(3, 0, 0), VGA_RGB(3, 0, 0), VGA_RGB(0, 3, 0), VGA_RGB(0, 3, 0),
+    VGA_RGB(0, 0, 3), VGA_RGB(0, 0, 3), VGA_RGB(3, 3, 0), VGA_RGB(3, 3, 0),
+    VGA_RGB(0, 3, 3), VGA_RGB(0, 3, 3), VGA_RGB(3, 0, 3), VGA_RGB(3, 0, 3),
+};
+
+const r3d_mesh_t r3d_cube = {cube_vertices, cube_faces, cube_colors, 8, 12};
+
+// What core 0 hands core 1 for a frame: screen positions of the vertices,
+// and the visible faces far to near with their shaded colors
+typedef struct
+{
+    short x[R3D_MAX_VERTICES], y[R3D_MAX_VERTICES];
+    uint8_t order[R3D_MAX_FACES];
+    char colors[R3D_MAX_FACES];
+    const uint8_t (*faces)[3];
+    int count;
+    short x0, y0, x1, y1; // bounds of the vertices used, on screen
+} frame_t;
+
+// Buffers taken from the heap for as long as r3d runs: the two frames, the
+// rotated vertices and which of them are too close to project, and the
+// depth (0 for faces left out) and shaded color of each face in mesh order
+typedef struct
+{
+    frame_t frames[2];
+    short view[R3D_MAX_VERTICES][3];
+    bool behind[R3D_MAX_VERTICES];
+    int depth[R3D_MAX_FACES];
+    char shaded[R3D_MAX_FACES];
+} buffers_t;
+
+static buffers_t *buffers;
+static int next;    // frame core 0 fills next
+static int pending; // frames handed to core 1 and not yet drawn
+
+static int center_x, center_y, focal;
+static char background;
+static bool dual;
+
+// Bounds of the frame drawn before, to clear. Only the drawing core uses
+// it.
+static short last_x0, last_y0, last_x1 = -1, last_y1 = -1;
+
+// Core 1 only calls the drawing code, so it runs from wherever that does
+static void VGA_RAM_FUNC(rasterize)(const frame_t *f)
+{
+    if (last_x1 >= last_x0 && last_y1 >= last_y0)
+        fillRect(last_x0, last_y0, last_x1 - last_x0 + 1, last_y1 - last_y0 + 1, background);
+
+    for (int i = 0; i < f->count; i++)
+    {
+        const uint8_t *v = f->faces[f->order[i]];
+        fillTriangle(f->x[v[0]], f->y[v[0]], f->x[v[1]], f->y[v[1]], f->x[v[2]], f->y[v[2]], f->colors[i]);
+    }
+
+    last_x0 = f->x0;
+    last_y0 = f->y0;
+    last_x1 = f->x1;
+    last_y1 = f->y1;
+}
+
+static void VGA_RAM_FUNC(core1_main)()
+{
+    while (true)
+    {
+        rasterize(&buffers->frames[multicore_fifo_pop_blocking()]);
+        multicore_fifo_push_blocking(0);
+    }
+}
+
+static uint32_t isqrt(uint32_t n)
+{
+    uint32_t root = 0;
+    for (uint32_t bit = 1u << 30; bit; bit >>= 2)
+        if (n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+    return root;
+}
+
+// Scale a channel level (0-3) by light out of 256
+static inline int shade_level(int level, int light)
+{
+    return (level * light + 128) >> 8;
+}
+
+bool r3d_init(int x, int y, int f, char bg, bool use_core1)
+{
+    if (!buffers)
+        buffers = malloc(sizeof(buffers_t));
+    if (!buffers)
+        return false;
+
+    center_x = x;
+    center_y = y;
+    focal = f;
+    background = bg;
+    dual = use_core1;
+    next = 0;
+    pending = 0;
+    last_x1 = last_y1 = -1;
+    if (dual)
+        multicore_launch_core1(core1_main);
+    return true;
+}
+
+int r3d_frame(const r3d_mesh_t *mesh, int ax, int ay, int az, int distance)
+{
+    // The buffer to fill was handed over two frames ago
+    if (dual && pending == 2)
+    {
+        multicore_fifo_pop_blocking();
+        pending--;
+    }
+    frame_t *f = &buffers->frames[next];
+    short (*view)[3] = buffers->view;
+    bool *behind = buffers->behind;
+    int *depth = buffers->depth;
+    char *shaded = buffers->shaded;
+
+    // Rotation around x, then y, then z
+    float a = ax * (6.2831853f / R3D_TURN), b = ay * (6.2831853f / R3D_TURN), c = az * (6.2831853f / R3D_TURN);
+    float sa = sinf(a), ca = cosf(a), sb = sinf(b), cb = cosf(b), sc = sinf(c), cc = cosf(c);
+    const float m[3][3] = {
+        {cc * cb, cc * sb * sa - sc * ca, cc * sb * ca + sc * sa},
+        {sc * cb, sc * sb * sa + cc * ca, sc * sb * ca - cc * sa},
+        {-sb, cb * sa, cb * ca},
+    };
+    int32_t r[3][3];
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            r[i][j] = (int32_t)(m[i][j] * (1 << FRACTION));
+
+    // Model z points at the viewer, screen y down
+    int vertices = mesh->vertex_count < R3D_MAX_VERTICES ? mesh->vertex_count : R3D_MAX_VERTICES;
+    for (int i = 0; i < vertices; i++)
+    {
+        const r3d_vertex_t *v = &mesh->vertices[i];
+        for (int k = 0; k < 3; k++)
+            view[i][k] = (r[k][0] * v->x + r[k][1] * v->y + r[k][2] * v->z) >> FRACTION;
+
+        int z = distance - view[i][2];
+        behind[i] = z < NEAR;
+        if (!behind[i])
+        {
+            f->x[i] = center_x + view[i][0] * focal / z;
+            f->y[i] = center_y - view[i][1] * focal / z;
+        }
+    }
+
+    // Visible faces, their depth and color
+    int faces = mesh->face_count < R3D_MAX_FACES ? mesh->face_count : R3D_MAX_FACES;
+    int count = 0, near = 0x7fffffff, far = -0x7fffffff;
+    int x0 = VGA_WIDTH, y0 = VGA_HEIGHT, x1 = -1, y1 = -1;
+    for (int i = 0; i < faces; i++)
+    {
+        const uint8_t *v = mesh->faces[i];
+        depth[i] = 0;
+        if (v[0] >= vertices || v[1] >= vertices || v[2] >= vertices || behind[v[0]] || behind[v[1]] ||
+            behind[v[2]])
+            continue;
+
+        // Counterclockwise in the model is clockwise on screen
+        int32_t area = (f->x[v[1]] - f->x[v[0]]) * (f->y[v[2]] - f->y[v[0]]) -
+                       (f->y[v[1]] - f->y[v[0]]) * (f->x[v[2]] - f->x[v[0]]);
+        if (area >= 0)
+            continue;
+
+        // Light from the upper left, behind the viewer
+        int32_t e[2][3], n[3];
+        for (int k = 0; k < 3; k++)
+        {
+            e[0][k] = view[v[1]][k] - view[v[0]][k];
+            e[1][k] = view[v[2]][k] - view[v[0]][k];
+        }
+        n[0] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+        n[1] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+        n[2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+        while (abs(n[0]) > 16383 || abs(n[1]) > 16383 || abs(n[2]) > 16383)
+        {
+            n[0] /= 2;
+            n[1] /= 2;
+            n[2] /= 2;
+        }
+        int32_t length = isqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        int32_t dot = -105 * n[0] + 105 * n[1] + 209 * n[2];
+        int light = AMBIENT + (dot > 0 && length ? dot / length * (256 - AMBIENT) / 256 : 0);
+
+        char base = mesh->colors[i];
+        shaded[i] = VGA_RGB(shade_level(VGA_RED(base), light), shade_level(VGA_GREEN(base), light),
+                            shade_level(VGA_BLUE(base), light));
+
+        // Sum of the distances, which sorts the same as the mean
+        depth[i] = 3 * distance - view[v[0]][2] - view[v[1]][2] - view[v[2]][2];
+        near = depth[i] < near ? depth[i] : near;
+        far = depth[i] > far ? depth[i] : far;
+        count++;
+
+        for (int k = 0; k < 3; k++)
+        {
+            x0 = f->x[v[k]] < x0 ? f->x[v[k]] : x0;
+            x1 = f->x[v[k]] > x1 ? f->x[v[k]] : x1;
+            y0 = f->y[v[k]] < y0 ? f->y[v[k]] : y0;
+            y1 = f->y[v[k]] > y1 ? f->y[v[k]] : y1;
+        }
+    }
+
+    // Far to near, by buckets of depth
+    uint16_t start[BUCKETS + 1] = {0};
+    int range = far - near + 1;
+    for (int i = 0; i < faces; i++)
+        if (depth[i])
+            start[(far - depth[i]) * BUCKETS / range + 1]++;
+    for (int k = 0; k < BUCKETS; k++)
+        start[k + 1] += start[k];
+    for (int i = 0; i < faces; i++)
+        if (depth[i])
+        {
+            int k = start[(far - depth[i]) * BUCKETS / range]++;
+            f->order[k] = i;
+            f->colors[k] = shaded[i];
+        }
+
+    f->faces = mesh->faces;
+    f->count = count;
+    f->x0 = x0 < 0 ? 0 : x0;
+    f->y0 = y0 < 0 ? 0 : y0;
+    f->x1 = x1 > VGA_WIDTH - 1 ? VGA_WIDTH - 1 : x1;
+    f->y1 = y1 > VGA_HEIGHT - 1 ? VGA_HEIGHT - 1 : y1;
+
+    if (dual)
+    {
+        multicore_fifo_push_blocking(next);
+        pending++;
+    }
+    else
+        rasterize(f);
+    next ^= 1;
+    return count;
+}
+
+void r3d_finish(void)
+{
+    while (pending)
+    {
+        multicore_fifo_pop_blocking();
+        pending--;
+    }
+}
+
+void r3d_stop(void)
+{
+    r3d_finish();
+    if (dual)
+        multicore_reset_core1();
+    dual = false;
+    free(buffers);
+    buffers = NULL;
+}
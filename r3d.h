@@ -0,0 +1,68 @@
+/**
+ * Flat shaded 3D models, split across both cores
+ *
+ * Core 0 rotates and projects the vertices in fixed point, drops faces
+ * turned away from the viewer, lights the rest from a fixed direction and
+ * sorts them far to near into buckets by depth. The result goes into one
+ * of two frame buffers of screen vertices and face lists. Core 1 takes
+ * each frame in turn, clears what the one before covered and fills the
+ * triangles in that order with fillTriangle(), so nearer faces paint over
+ * farther ones without a Z-buffer. While it does, core 0 works on the next
+ * frame in the other buffer. Faces of one mesh that cross each other in
+ * depth can come out in the wrong order, which convex and most simple
+ * models never do.
+ *
+ * Frames go straight to the screen, so a frame being drawn can show
+ * partly. Use r3d_init() without core 1 to run everything on core 0.
+ *
+ * The frames and the per vertex and per face work take about 4 kB, which
+ * r3d_init() takes from the heap and r3d_stop() gives back.
+ */
+
+#ifndef R3D_H
+#define R3D_H
+
+#include "vga.h"
+
+#define R3D_MAX_VERTICES 128
+#define R3D_MAX_FACES 256
+
+// Full turn in the angle units of r3d_frame()
+#define R3D_TURN 1024
+
+typedef struct
+{
+    short x, y, z;
+} r3d_vertex_t;
+
+// Faces list their vertices counterclockwise seen from outside, and have a
+// color each
+typedef struct
+{
+    const r3d_vertex_t *vertices;
+    const uint8_t (*faces)[3];
+    const char *colors;
+    short vertex_count;
+    short face_count;
+} r3d_mesh_t;
+
+// A cube of side 2 * 64 with differently colored sides
+extern const r3d_mesh_t r3d_cube;
+
+// Project to center x, y with focal length focal (pixels for a distance of
+// one model unit), over a background color. With dual, core 1 draws.
+// Returns false if there isn't enough memory.
+bool r3d_init(int x, int y, int focal, char background, bool dual);
+
+// Draw a mesh rotated by the given angles around x, then y, then z and
+// distance model units in front of the viewer. Returns as soon as the
+// frame is handed over, with the number of faces that were visible.
+int r3d_frame(const r3d_mesh_t *mesh, int ax, int ay, int az, int distance);
+
+// Wait for the frames handed over to be drawn
+void r3d_finish(void);
+
+// Finish and give core 1 back
+void r3d_stop(void);
+
+#endif
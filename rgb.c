@@ -0,0 +1,144 @@
+/**
+ * RGB conversion, see rgb.h
+ *
+ * Plain C with no SDK dependencies, it also runs in the host benchmark.
+ */
+
+#include <stdbool.h>
+#include "rgb.h"
+#include "swar.h"
+
+static const uint8_t levels[4] = {VGA_LEVEL(0), VGA_LEVEL(1), VGA_LEVEL(2), VGA_LEVEL(3)};
+
+// Position of each 8-bit value between the DAC levels in 1/16 steps, 0 for
+// level 0 up to 48 for level 3. (step + t) >> 4 for t in 0..15 picks the
+// upper of the two levels around the value in (step % 16) of 16 cases.
+static uint8_t steps[256];
+
+// Nearest level of each 8-bit value
+static uint8_t nearest[256];
+
+// Pixels for the channel intensities r | g << 2 | b << 4
+static uint8_t pixels[64];
+
+static bool tables_ready;
+
+// 4x4 Bayer matrix, thresholds 0-15
+static const uint8_t bayer[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+static void init_tables()
+{
+    for (int v = 0; v < 256; v++)
+    {
+        int k = v >= levels[2] ? 2 : v >= levels[1] ? 1 : 0;
+        int span = levels[k + 1] - levels[k];
+        steps[v] = k * 16 + ((v - levels[k]) * 16 + span / 2) / span;
+        nearest[v] = v - levels[k] > levels[k + 1] - v ? k + 1 : k;
+    }
+    for (int c = 0; c < 64; c++)
+        pixels[c] = vga_swar_levels(c);
+    tables_ready = true;
+}
+
+uint8_t rgb_to_pixel(uint8_t r, uint8_t g, uint8_t b)
+{
+    if (!tables_ready)
+        init_tables();
+    return pixels[nearest[r] | (nearest[g] << 2) | (nearest[b] << 4)];
+}
+
+static inline int clamp8(int v)
+{
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+// Pixel for the channel steps of a color plus a dither threshold
+static inline uint32_t dither_pixel(const uint8_t *rgb, int t)
+{
+    return pixels[((steps[rgb[0]] + t) >> 4) | (((steps[rgb[1]] + t) >> 4) << 2) | (((steps[rgb[2]] + t) >> 4) << 4)];
+}
+
+// Collects pixels into packed words
+typedef struct
+{
+    uint32_t *words;
+    uint32_t word;
+    int n;
+} packer_t;
+
+static inline void pack(packer_t *p, uint32_t c)
+{
+    p->word = (p->word << VGA_BITS_PER_PIXEL) | c;
+    if (++p->n == VGA_PIXELS_PER_WORD)
+    {
+        *p->words++ = p->word;
+        p->word = 0;
+        p->n = 0;
+    }
+}
+
+static inline void pack_end(packer_t *p)
+{
+    if (p->n)
+        *p->words = p->word << (VGA_BITS_PER_PIXEL * (VGA_PIXELS_PER_WORD - p->n));
+}
+
+// Floyd-Steinberg. errors[3 * (i + 1) + c] holds the error (in 1/16) for
+// pixel i from the row above, and is overwritten for the row below once
+// pixel i + 1 has read its own.
+static void diffuse_row(const uint8_t *rgb, int w, int16_t *errors, packer_t *p)
+{
+    int right[3] = {0, 0, 0}, below_left[3] = {0, 0, 0}, below[3] = {0, 0, 0};
+
+    for (int i = 0; i < w; i++, rgb += 3)
+    {
+        int q[3];
+        for (int c = 0; c < 3; c++)
+        {
+            int v = clamp8(rgb[c] + ((right[c] + errors[3 * (i + 1) + c] + 8) >> 4));
+            q[c] = nearest[v];
+            int e = v - levels[q[c]];
+
+            right[c] = e * 7;
+            errors[3 * i + c] = below_left[c] + e * 3;
+            below_left[c] = below[c] + e * 5;
+            below[c] = e;
+        }
+        pack(p, pixels[q[0] | (q[1] << 2) | (q[2] << 4)]);
+    }
+    for (int c = 0; c < 3; c++)
+    {
+        errors[3 * w + c] = below_left[c];
+        errors[3 * (w + 1) + c] = 0;
+    }
+}
+
+void rgb_convert_row(const uint8_t *rgb, int w, int x, int y, int dither, int16_t *errors, uint32_t *words)
+{
+    if (!tables_ready)
+        init_tables();
+
+    packer_t p = {words, 0, 0};
+    const uint8_t *t = bayer[y & 3];
+
+    switch (dither)
+    {
+    case RGB_DITHER_ORDERED:
+        for (int i = 0; i < w; i++, rgb += 3)
+            pack(&p, dither_pixel(rgb, t[(x + i) & 3]));
+        break;
+    case RGB_DITHER_DIFFUSE:
+        diffuse_row(rgb, w, errors, &p);
+        break;
+    default:
+        for (int i = 0; i < w; i++, rgb += 3)
+            pack(&p, rgb_to_pixel(rgb[0], rgb[1], rgb[2]));
+        break;
+    }
+    pack_end(&p);
+}
@@ -0,0 +1,43 @@
+/**
+ * Conversion of 24-bit RGB colors and images to the 64-color palette
+ *
+ * Each 8-bit channel goes to one of the four DAC levels. The levels are not
+ * evenly spaced (see VGA_LEVEL in pixel.h), so conversion picks the nearest
+ * level rather than using the top two bits, which would for example show
+ * 0x30 as 71 instead of 0.
+ *
+ *  RGB_DITHER_NONE     nearest level
+ *  RGB_DITHER_ORDERED  4x4 Bayer matrix between the two nearest levels, by
+ *                      screen position, so still images don't shimmer
+ *  RGB_DITHER_DIFFUSE  Floyd-Steinberg error diffusion, the smoothest result
+ *                      but each row depends on the one before
+ *
+ * Rows are converted straight to packed words (pixel.h). Plain C with no SDK
+ * dependencies, host tools can use it too.
+ */
+
+#ifndef RGB_H
+#define RGB_H
+
+#include <stdint.h>
+#include "pixel.h"
+
+#define RGB_DITHER_NONE 0
+#define RGB_DITHER_ORDERED 1
+#define RGB_DITHER_DIFFUSE 2
+
+// Length of the error buffer for RGB_DITHER_DIFFUSE rows of w pixels
+#define RGB_ERRORS(w) (3 * ((w) + 2))
+
+// Nearest pixel value for a color
+uint8_t rgb_to_pixel(uint8_t r, uint8_t g, uint8_t b);
+
+// Convert w pixels of r, g, b byte triples to packed words, padding the last
+// word with black. x and y are the screen position of the first pixel, for
+// the ordered dither pattern. For
+// RGB_DITHER_DIFFUSE errors holds RGB_ERRORS(w) values, zeroed before the
+// first row of an image and passed unchanged with every following row;
+// otherwise it may be NULL.
+void rgb_convert_row(const uint8_t *rgb, int w, int x, int y, int dither, int16_t *errors, uint32_t *words);
+
+#endif
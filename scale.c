@@ -0,0 +1,209 @@
+/**
+ * Scaled blits, see scale.h
+ */
+
+#include "scale.h"
+
+#define ONE (1 << 16)
+
+// Channel intensities of a pixel spread into 4-bit fields (red in bits 0-3,
+// green 4-7, blue 8-11), so four of them can be summed in one addition
+static uint16_t spread[64];
+
+// Pixel for intensities packed as r | g << 2 | b << 4
+static uint8_t unspread[64];
+
+static bool tables_ready;
+
+static void init_tables()
+{
+    for (int c = 0; c < 64; c++)
+    {
+        spread[c] = VGA_RED(c) | (VGA_GREEN(c) << 4) | (VGA_BLUE(c) << 8);
+        unspread[c] = VGA_RGB(c & 3, (c >> 2) & 3, c >> 4);
+    }
+    tables_ready = true;
+}
+
+// Average of four pixels, rounded per channel
+static inline uint32_t average4(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+    uint32_t sum = (spread[a] + spread[b] + spread[c] + spread[d] + 0x222) >> 2;
+    return unspread[(sum & 3) | ((sum >> 2) & 0x0c) | ((sum >> 4) & 0x30)];
+}
+
+// A horizontal position in the source as word, pixel within the word and
+// fraction, with the per-pixel step split the same way
+typedef struct
+{
+    int x; // pixel index in the row
+    int word;
+    int sub;
+    uint32_t frac;
+    int step_word;
+    int step_sub;
+    int step_int;
+    uint32_t step_frac;
+} stepper_t;
+
+static void stepper_init(stepper_t *s, uint32_t pos, uint32_t step)
+{
+    s->x = pos >> 16;
+    s->word = s->x / 5;
+    s->sub = s->x % 5;
+    s->frac = pos & (ONE - 1);
+    s->step_int = step >> 16;
+    s->step_word = s->step_int / 5;
+    s->step_sub = s->step_int % 5;
+    s->step_frac = step & (ONE - 1);
+}
+
+static inline void stepper_advance(stepper_t *s)
+{
+    s->frac += s->step_frac;
+    uint32_t carry = s->frac >> 16;
+    s->frac &= ONE - 1;
+    s->x += s->step_int + carry;
+    s->sub += s->step_sub + carry;
+    s->word += s->step_word;
+    if (s->sub >= 5)
+    {
+        s->sub -= 5;
+        s->word++;
+    }
+}
+
+static inline uint32_t get_pixel(const uint32_t *row, int word, int sub)
+{
+    return (row[word] >> VGA_PIXEL_SHIFT(sub)) & VGA_PIXEL_MASK;
+}
+
+static inline void put_word(uint32_t *dst, int i, int first, int last, uint32_t value)
+{
+    if (first == 0 && last == 4)
+        dst[i] = value;
+    else
+    {
+        uint32_t mask = VGA_SPAN_MASK(first, last);
+        dst[i] = (dst[i] & ~mask) | (value & mask);
+    }
+}
+
+static void VGA_RAM_FUNC(scale_row_nearest)(uint32_t *dst, int x0, int x1, const uint32_t *src, stepper_t s)
+{
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    for (int i = w0; i <= w1; i++)
+    {
+        int first = (i == w0) ? x0 % 5 : 0;
+        int last = (i == w1) ? x1 % 5 : 4;
+        uint32_t value = 0;
+
+        for (int p = first; p <= last; p++)
+        {
+            value |= get_pixel(src, s.word, s.sub) << VGA_PIXEL_SHIFT(p);
+            stepper_advance(&s);
+        }
+        put_word(dst, i, first, last, value);
+    }
+}
+
+// src0 and src1 are the rows above and below the sample, x_last the last
+// pixel of the source block
+static void VGA_RAM_FUNC(scale_row_average)(uint32_t *dst, int x0, int x1, const uint32_t *src0,
+                                            const uint32_t *src1, int x_last, stepper_t s)
+{
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    for (int i = w0; i <= w1; i++)
+    {
+        int first = (i == w0) ? x0 % 5 : 0;
+        int last = (i == w1) ? x1 % 5 : 4;
+        uint32_t value = 0;
+
+        for (int p = first; p <= last; p++)
+        {
+            // The right neighbor, or the same pixel at the edge
+            int word = s.word, sub = s.sub;
+            if (s.x < x_last && ++sub == 5)
+            {
+                sub = 0;
+                word++;
+            }
+
+            uint32_t c = average4(get_pixel(src0, s.word, s.sub), get_pixel(src0, word, sub),
+                                  get_pixel(src1, s.word, s.sub), get_pixel(src1, word, sub));
+            value |= c << VGA_PIXEL_SHIFT(p);
+            stepper_advance(&s);
+        }
+        put_word(dst, i, first, last, value);
+    }
+}
+
+void blitScaled(const vga_surface_t *src, int sx, int sy, int sw, int sh, int dx, int dy, int dw, int dh,
+                int filter)
+{
+    if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0)
+        return;
+    if (sx < 0 || sy < 0 || sx + sw > src->width || sy + sh > src->height)
+        return;
+
+    int x0 = dx < 0 ? 0 : dx;
+    int x1 = dx + dw > VGA_WIDTH ? VGA_WIDTH - 1 : dx + dw - 1;
+    int y0 = dy < 0 ? 0 : dy;
+    int y1 = dy + dh > VGA_HEIGHT ? VGA_HEIGHT - 1 : dy + dh - 1;
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    if (filter == SCALE_AVERAGE && !tables_ready)
+        init_tables();
+
+    // Sample at the center of each destination pixel. Averaging takes the
+    // pixel left of and above the sample with the next ones, so the sample
+    // moves half a pixel back.
+    uint32_t du = ((uint32_t)sw << 16) / dw;
+    uint32_t dv = ((uint32_t)sh << 16) / dh;
+    int32_t u = du / 2 + (x0 - dx) * du;
+    int32_t v0 = dv / 2 + (y0 - dy) * dv;
+    if (filter == SCALE_AVERAGE)
+    {
+        u -= ONE / 2;
+        v0 -= ONE / 2;
+    }
+
+    // Samples left of or above the block take its first column or row for
+    // both of the pixels averaged. The others step on from the unclamped
+    // position, so the row isn't shifted.
+    int lead = 0;
+    if (u < 0)
+    {
+        lead = (-u + du - 1) / du;
+        if (lead > x1 - x0 + 1)
+            lead = x1 - x0 + 1;
+        u += lead * du;
+    }
+    stepper_t edge, s;
+    stepper_init(&edge, (uint32_t)sx << 16, 0);
+    stepper_init(&s, u + ((uint32_t)sx << 16), du);
+
+    for (int y = y0; y <= y1; y++)
+    {
+        int32_t v = v0 + (y - y0) * dv;
+        int row = sy + (v < 0 ? 0 : v >> 16);
+        uint32_t *dst = vga_row(y);
+
+        if (filter == SCALE_AVERAGE)
+        {
+            int below = v >= 0 && row + 1 < sy + sh ? row + 1 : row;
+            const uint32_t *src0 = surfaceRow(src, row), *src1 = surfaceRow(src, below);
+            if (lead)
+                scale_row_average(dst, x0, x0 + lead - 1, src0, src1, sx, edge);
+            if (x0 + lead <= x1)
+                scale_row_average(dst, x0 + lead, x1, src0, src1, sx + sw - 1, s);
+        }
+        else
+            scale_row_nearest(dst, x0, x1, surfaceRow(src, row), s);
+    }
+}
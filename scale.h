@@ -0,0 +1,27 @@
+/**
+ * Scaled blits from packed surfaces to the screen
+ *
+ * A sw x sh block of a surface is stretched or shrunk to fill a dw x dh
+ * rectangle on the screen. Source positions are stepped in 16.16 fixed
+ * point and output is assembled a word (5 pixels) at a time.
+ *
+ *  SCALE_NEAREST  each pixel takes the nearest source pixel
+ *  SCALE_AVERAGE  each pixel is the average of the 2x2 source pixels around
+ *                 its position, per channel, which smooths upscaled edges
+ *                 and reduces aliasing when shrinking
+ */
+
+#ifndef SCALE_H
+#define SCALE_H
+
+#include "vga.h"
+
+#define SCALE_NEAREST 0
+#define SCALE_AVERAGE 1
+
+// The source block must lie inside the surface. The destination is clipped
+// to the screen.
+void blitScaled(const vga_surface_t *src, int sx, int sy, int sw, int sh, int dx, int dy, int dw, int dh,
+                int filter);
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * Drawing from both cores at once, see shared.h
+ */
+
+#include "hardware/sync.h"
+#include "shared.h"
+#include "span.h"
+
+static spin_lock_t *locks[SHARED_STRIPES];
+
+// The lock for a word of vga_data_array, by the row of memory it is in.
+// Rows can be in any order in vga_line_table, so this is not the same as
+// the row on screen.
+static inline spin_lock_t *stripe(const uint32_t *word)
+{
+    return locks[((word - vga_data_array) / VGA_LINE_WORDS) & (SHARED_STRIPES - 1)];
+}
+
+void shared_init(void)
+{
+    // Already claimed
+    if (locks[0])
+        return;
+
+    for (int i = 0; i < SHARED_STRIPES; i++)
+        locks[i] = spin_lock_init(spin_lock_claim_unused(true));
+}
+
+void VGA_RAM_FUNC(drawPixelShared)(int x, int y, char color)
+{
+    if ((unsigned)x >= VGA_WIDTH || (unsigned)y >= VGA_HEIGHT)
+        return;
+
+    uint32_t *word = &vga_row(y)[x / 5];
+    int shift = VGA_PIXEL_SHIFT(x % 5);
+    spin_lock_t *lock = stripe(word);
+
+    uint32_t save = spin_lock_blocking(lock);
+    *word = (*word & ~(VGA_PIXEL_MASK << shift)) | ((color & VGA_PIXEL_MASK) << shift);
+    spin_unlock(lock, save);
+}
+
+void VGA_RAM_FUNC(drawHLineShared)(int x, int y, int w, char color)
+{
+    fillRectShared(x, y, w, 1, color);
+}
+
+void VGA_RAM_FUNC(fillRectShared)(int x, int y, int w, int h, char color)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, VGA_WIDTH, VGA_HEIGHT))
+        return;
+
+    // A screen row is a row of memory, and so under a single lock
+    for (int row = y; row < y + h; row++)
+    {
+        uint32_t *words = vga_row(row);
+        spin_lock_t *lock = stripe(words);
+        uint32_t save = spin_lock_blocking(lock);
+        vga_span_fill(words, x, x + w - 1, color & VGA_PIXEL_MASK);
+        spin_unlock(lock, save);
+    }
+}
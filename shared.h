@@ -0,0 +1,40 @@
+/**
+ * Drawing from both cores at once
+ *
+ * Pixels share words, so drawing a pixel reads, changes and writes back a
+ * whole word. When both cores do that to the same word at the same time,
+ * one of the writes is lost. The functions here take a hardware spin lock
+ * around every word they change. The locks are striped over the rows of
+ * vga_data_array, so the cores only wait on each other when they draw on
+ * rows with the same stripe at the same moment.
+ *
+ * Whole word stores can race with another core's read-modify-write just
+ * the same, so everything either core draws into shared memory has to go
+ * through here, or be kept to rows (or whole words) the other core never
+ * touches. Cores drawing disjoint parts of the screen can keep using gfx.h
+ * and need none of this.
+ *
+ * The locks disable interrupts while held, so these must not be called
+ * from an interrupt handler.
+ */
+
+#ifndef SHARED_H
+#define SHARED_H
+
+#include "vga.h"
+
+// Spin locks claimed by shared_init(), a power of two
+#define SHARED_STRIPES 8
+
+// Claim the spin locks before any of the rest. Calling it again does
+// nothing.
+void shared_init(void);
+
+// Like drawPixel(), except that pixels outside the screen are dropped
+void drawPixelShared(int x, int y, char color);
+
+// Like drawHLine() and fillRect(), taking the lock once per row
+void drawHLineShared(int x, int y, int w, char color);
+void fillRectShared(int x, int y, int w, int h, char color);
+
+#endif
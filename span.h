@@ -0,0 +1,129 @@
+/**
+ * Span primitives on packed rows, shared by the drawing code and the
+ * compositor
+ *
+ * A row is an array of packed words (pixel.h), of the screen, a surface or
+ * a line buffer. Spans are given in pixels and must already be clipped;
+ * only the partial words at either end are read-modify-written.
+ */
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <stdbool.h>
+#include "pixel.h"
+#include "swar.h"
+
+// Clip the w x h rectangle at (x, y) to width x height. Returns false if
+// nothing is left.
+static inline bool vga_clip_rect(int *x, int *y, int *w, int *h, int width, int height)
+{
+    if (*x < 0)
+    {
+        *w += *x;
+        *x = 0;
+    }
+    if (*y < 0)
+    {
+        *h += *y;
+        *y = 0;
+    }
+    if (*x + *w > width)
+        *w = width - *x;
+    if (*y + *h > height)
+        *h = height - *y;
+    return *w > 0 && *h > 0;
+}
+
+static inline void vga_put_masked(uint32_t *word, uint32_t value, uint32_t mask)
+{
+    *word = (*word & ~mask) | (value & mask);
+}
+
+// Fill pixels x0..x1 (inclusive, already clipped) of a row
+static inline void vga_span_fill(uint32_t *row, int x0, int x1, uint32_t color)
+{
+    uint32_t solid = VGA_SOLID(color);
+    int w0 = x0 / 5;
+    int w1 = x1 / 5;
+
+    if (w0 == w1)
+    {
+        vga_put_masked(&row[w0], solid, VGA_SPAN_MASK(x0 % 5, x1 % 5));
+        return;
+    }
+
+    vga_put_masked(&row[w0], solid, VGA_SPAN_MASK(x0 % 5, 4));
+    for (int i = w0 + 1; i < w1; i++)
+        row[i] = solid;
+    vga_put_masked(&row[w1], solid, VGA_SPAN_MASK(0, x1 % 5));
+}
+
+// The 5 pixels starting at pixel p (-4 or more) of a row of the given length
+// in words. Pixels outside the row read as 0.
+static inline uint32_t vga_fetch5(const uint32_t *row, int words, int p)
+{
+    int k = (p + 5) / 5 - 1;
+    int off = (p + 5) % 5;
+    uint32_t hi = (k >= 0 && k < words) ? row[k] : 0;
+
+    if (off == 0)
+        return hi;
+
+    uint32_t lo = (k + 1 < words) ? row[k + 1] : 0;
+    return ((hi << (off * VGA_BITS_PER_PIXEL)) | (lo >> (30 - off * VGA_BITS_PER_PIXEL))) & VGA_WORD_MASK;
+}
+
+// Copy w pixels from pixel sx of src to pixel dx of dst (already clipped)
+static inline void vga_span_copy(uint32_t *dst, int dx, const uint32_t *src, int src_words, int sx, int w)
+{
+    int x1 = dx + w - 1;
+    int w0 = dx / 5;
+    int w1 = x1 / 5;
+    int delta = sx - dx;
+
+    for (int i = w0; i <= w1; i++)
+    {
+        int first = (i == w0) ? dx % 5 : 0;
+        int last = (i == w1) ? x1 % 5 : 4;
+        uint32_t value = vga_fetch5(src, src_words, i * 5 + delta);
+
+        if (first == 0 && last == 4)
+            dst[i] = value;
+        else
+            vga_put_masked(&dst[i], value, VGA_SPAN_MASK(first, last));
+    }
+}
+
+// Like vga_span_copy_keyed, also storing the mask of the pixels it set in
+// each word in cover (unless NULL), cover[0] for word dx / 5
+static inline void vga_span_copy_cover(uint32_t *dst, int dx, const uint32_t *src, int src_words, int sx, int w,
+                                       uint32_t key, uint32_t *cover)
+{
+    int x1 = dx + w - 1;
+    int w0 = dx / 5;
+    int w1 = x1 / 5;
+    int delta = sx - dx;
+
+    for (int i = w0; i <= w1; i++)
+    {
+        uint32_t value = vga_fetch5(src, src_words, i * 5 + delta);
+        uint32_t mask = vga_swar_key_mask(value, key);
+
+        if (i == w0 || i == w1)
+            mask &= VGA_SPAN_MASK(i == w0 ? dx % 5 : 0, i == w1 ? x1 % 5 : 4);
+        if (mask)
+            vga_put_masked(&dst[i], value, mask);
+        if (cover)
+            cover[i - w0] = mask;
+    }
+}
+
+// Like vga_span_copy, leaving the destination alone where the source is key
+static inline void vga_span_copy_keyed(uint32_t *dst, int dx, const uint32_t *src, int src_words, int sx, int w,
+                                       uint32_t key)
+{
+    vga_span_copy_cover(dst, dx, src, src_words, sx, w, key, NULL);
+}
+
+#endif
@@ -0,0 +1,280 @@
+/**
+ * 800x600 at 60 Hz from a 16-color framebuffer, see svga.h
+ */
+
+#include <string.h>
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/vreg.h"
+#include "hardware/structs/systick.h"
+#include "sync.pio.h"
+#include "rgb.pio.h"
+#include "span.h"
+#include "svga.h"
+
+#define SVGA_SYS_KHZ 200000 // 40 MHz pixels, 5 clocks each
+#define VGA_SYS_KHZ 125000
+
+// Core voltage for SVGA_SYS_KHZ, which is above what the default 1.10 V is
+// specified for, and how long the regulator takes to get there
+#define SVGA_VOLTAGE VREG_VOLTAGE_1_15
+#define SVGA_VOLTAGE_SETTLE_US 1000
+
+#define RGB_ACTIVE (SVGA_LINE_WORDS - 1)
+
+_Static_assert(SVGA_HEIGHT * SVGA_ROW_BYTES <= sizeof(vga_data_array), "framebuffer doesn't fit");
+
+static const int svga_chan_0 = 2;
+static const int svga_chan_1 = 3;
+static const uint sync_sm = 0;
+static const uint rgb_sm = 1;
+static int sync_offset = -1, rgb_offset;
+
+// The line buffers and the two pixels of each framebuffer byte, the left
+// one upper, live in the end of vga_data_array the framebuffer leaves free
+typedef struct
+{
+    uint32_t lines[SVGA_LINES][SVGA_LINE_WORDS];
+    uint16_t pairs[256];
+} spare_t;
+
+_Static_assert(SVGA_HEIGHT * SVGA_ROW_BYTES % 4 == 0 &&
+                   SVGA_HEIGHT * SVGA_ROW_BYTES + sizeof(spare_t) <= sizeof(vga_data_array),
+               "line buffers don't fit after the framebuffer");
+
+static spare_t *const spare = (spare_t *)&vga_data_array[SVGA_HEIGHT * SVGA_ROW_BYTES / 4];
+
+// Channel 1 walks this table round and round, by a DMA ring on its read
+// address
+static uint32_t *table[SVGA_LINES] __attribute__((aligned(sizeof(uint32_t *) * SVGA_LINES)));
+
+// CGA color i: bit 3 bright, bits 2-0 red, green and blue
+#define CGA_LEVEL(i, bit) ((i) & (bit) ? ((i) & 8 ? 3 : 2) : ((i) & 8 ? 1 : 0))
+#define CGA(i) VGA_RGB(CGA_LEVEL(i, 4), CGA_LEVEL(i, 2), CGA_LEVEL(i, 1))
+
+static char palette[SVGA_COLORS] = {CGA(0), CGA(1), CGA(2),  CGA(3),  CGA(4),  CGA(5),  CGA(6),  CGA(7),
+                                    CGA(8), CGA(9), CGA(10), CGA(11), CGA(12), CGA(13), CGA(14), CGA(15)};
+static bool running;
+
+static volatile uint32_t sent;
+static volatile uint32_t underruns;
+static volatile uint32_t late;
+static volatile uint32_t expand_cycles;
+static volatile uint32_t expanded;
+static volatile bool stopping;
+static uint32_t rgb_stall_bit;
+
+static void __not_in_flash_func(dma_handler)()
+{
+    dma_hw->ints1 = 1u << svga_chan_0;
+    sent++;
+
+    if (pio1->fdebug & rgb_stall_bit)
+    {
+        pio1->fdebug = rgb_stall_bit;
+        underruns++;
+    }
+}
+
+void __not_in_flash_func(svga_expand_line)(int y, uint32_t *line)
+{
+    const uint8_t *src = svga_row(y);
+
+    // Every 5 bytes are 10 pixels, or 2 words
+    for (int i = 0; i < SVGA_LINE_WORDS; i += 2, src += 5)
+    {
+        uint8_t middle = src[2];
+        line[i] = (spare->pairs[src[0]] << 18) | (spare->pairs[src[1]] << 6) | palette[middle >> 4];
+        line[i + 1] = (palette[middle & 15] << 24) | (spare->pairs[src[3]] << 12) | spare->pairs[src[4]];
+    }
+}
+
+static void __not_in_flash_func(core1_main)()
+{
+    // Count this core's clocks
+    systick_hw->rvr = 0xffffff;
+    systick_hw->csr = 5;
+
+    for (uint32_t n = 0; !stopping; n++)
+    {
+        // Wait for the buffer to be sent SVGA_LINES lines ago
+        while ((int32_t)(n - sent) >= SVGA_LINES)
+            tight_loop_contents();
+
+        uint32_t start = systick_hw->cvr;
+        svga_expand_line(n % SVGA_HEIGHT, spare->lines[n % SVGA_LINES]);
+        uint32_t cycles = (start - systick_hw->cvr) & 0xffffff;
+        if (cycles > expand_cycles)
+            expand_cycles = cycles;
+
+        if ((int32_t)(sent - n) >= 0)
+            late++;
+        expanded = n + 1;
+    }
+
+    while (true)
+        tight_loop_contents();
+}
+
+void svga_set_palette(int index, char color)
+{
+    if (index < 0 || index >= SVGA_COLORS)
+        return;
+
+    palette[index] = color & VGA_PIXEL_MASK;
+    if (!running)
+        return;
+    for (int i = 0; i < SVGA_COLORS; i++)
+    {
+        spare->pairs[index << 4 | i] = palette[index] << 6 | palette[i];
+        spare->pairs[i << 4 | index] = palette[i] << 6 | palette[index];
+    }
+}
+
+void svga_pixel(int x, int y, int color)
+{
+    if (x < 0 || x >= SVGA_WIDTH || y < 0 || y >= SVGA_HEIGHT)
+        return;
+
+    uint8_t *p = &svga_row(y)[x / 2];
+    if (x & 1)
+        *p = (*p & 0xf0) | (color & 15);
+    else
+        *p = (*p & 0x0f) | ((color & 15) << 4);
+}
+
+void svga_fill_rect(int x, int y, int w, int h, int color)
+{
+    if (!vga_clip_rect(&x, &y, &w, &h, SVGA_WIDTH, SVGA_HEIGHT))
+        return;
+
+    // Odd pixels at either end, whole bytes between
+    color &= 15;
+    int x1 = x + w;
+    for (int row = y; row < y + h; row++)
+    {
+        if (x & 1)
+            svga_pixel(x, row, color);
+        if (x1 & 1)
+            svga_pixel(x1 - 1, row, color);
+        int b0 = (x + 1) / 2, b1 = x1 / 2;
+        if (b1 > b0)
+            memset(&svga_row(row)[b0], color * 0x11, b1 - b0);
+    }
+}
+
+uint32_t svga_lines_sent(void)
+{
+    return sent;
+}
+
+uint32_t svga_underruns(void)
+{
+    return underruns;
+}
+
+uint32_t svga_late_lines(void)
+{
+    return late;
+}
+
+uint32_t svga_expand_cycles(void)
+{
+    return expand_cycles;
+}
+
+void svga_start(void)
+{
+    PIO pio = pio1;
+
+    if (sync_offset < 0)
+    {
+        sync_offset = pio_add_program(pio, &sync_svga_program);
+        rgb_offset = pio_add_program(pio, &rgb_program);
+    }
+
+    vga_pause();
+    vreg_set_voltage(SVGA_VOLTAGE);
+    busy_wait_us(SVGA_VOLTAGE_SETTLE_US);
+    set_sys_clock_khz(SVGA_SYS_KHZ, true);
+    memset(vga_data_array, 0, SVGA_HEIGHT * SVGA_ROW_BYTES);
+    for (int i = 0; i < 256; i++)
+        spare->pairs[i] = palette[i >> 4] << 6 | palette[i & 15];
+    running = true;
+
+    for (int i = 0; i < SVGA_LINES; i++)
+        table[i] = spare->lines[i];
+    sent = underruns = late = expand_cycles = expanded = 0;
+    stopping = false;
+
+    // Channel 0 sends a line to the rgb state machine and chains to channel 1,
+    // which restarts it on the next entry of the table
+    dma_channel_config c0 = dma_channel_get_default_config(svga_chan_0);
+    channel_config_set_transfer_data_size(&c0, DMA_SIZE_32);
+    channel_config_set_read_increment(&c0, true);
+    channel_config_set_write_increment(&c0, false);
+    channel_config_set_dreq(&c0, DREQ_PIO1_TX1);
+    channel_config_set_chain_to(&c0, svga_chan_1);
+    dma_channel_configure(svga_chan_0, &c0, &pio->txf[rgb_sm], spare->lines[0], SVGA_LINE_WORDS, false);
+
+    dma_channel_config c1 = dma_channel_get_default_config(svga_chan_1);
+    channel_config_set_transfer_data_size(&c1, DMA_SIZE_32);
+    channel_config_set_read_increment(&c1, true);
+    channel_config_set_write_increment(&c1, false);
+    channel_config_set_ring(&c1, false, __builtin_ctz(sizeof(table)));
+    dma_channel_configure(svga_chan_1, &c1, &dma_hw->ch[svga_chan_0].al3_read_addr_trig, table, 1, false);
+
+    dma_hw->ints1 = 1u << svga_chan_0;
+    dma_channel_set_irq1_enabled(svga_chan_0, true);
+    irq_set_exclusive_handler(DMA_IRQ_1, dma_handler);
+    irq_set_priority(DMA_IRQ_1, PICO_HIGHEST_IRQ_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    // Fill the ring before the first line goes out
+    multicore_launch_core1(core1_main);
+    while (expanded < SVGA_LINES)
+        tight_loop_contents();
+
+    uint32_t frame = sync_frame(SVGA_HEIGHT, 1, 4, 23);
+    sync_svga_program_init(pio, sync_sm, sync_offset, VGA_HSYNC_PIN, VGA_VSYNC_PIN, frame);
+    rgb_program_init(pio, rgb_sm, rgb_offset, VGA_RED_PIN);
+    gpio_set_outover(VGA_HSYNC_PIN, GPIO_OVERRIDE_INVERT);
+    gpio_set_outover(VGA_VSYNC_PIN, GPIO_OVERRIDE_INVERT);
+
+    pio_sm_put_blocking(pio, rgb_sm, RGB_ACTIVE);
+    rgb_stall_bit = 1u << (PIO_FDEBUG_TXSTALL_LSB + rgb_sm);
+    pio->fdebug = rgb_stall_bit;
+    pio_enable_sm_mask_in_sync(pio, (1u << sync_sm) | (1u << rgb_sm));
+    dma_start_channel_mask(1u << svga_chan_1);
+}
+
+void svga_stop(void)
+{
+    // Finish the frame
+    uint32_t frame = sent / SVGA_HEIGHT;
+    while (sent / SVGA_HEIGHT == frame)
+        tight_loop_contents();
+
+    pio_set_sm_mask_enabled(pio1, (1u << sync_sm) | (1u << rgb_sm), false);
+    dma_channel_set_irq1_enabled(svga_chan_0, false);
+    irq_set_enabled(DMA_IRQ_1, false);
+    hw_write_masked(&dma_hw->ch[svga_chan_0].al1_ctrl, svga_chan_0 << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_abort(svga_chan_1);
+    dma_channel_abort(svga_chan_0);
+    dma_hw->ints1 = 1u << svga_chan_0;
+
+    stopping = true;
+    multicore_reset_core1();
+    running = false;
+
+    gpio_set_outover(VGA_HSYNC_PIN, GPIO_OVERRIDE_NORMAL);
+    gpio_set_outover(VGA_VSYNC_PIN, GPIO_OVERRIDE_NORMAL);
+    set_sys_clock_khz(VGA_SYS_KHZ, true);
+    vreg_set_voltage(VREG_VOLTAGE_DEFAULT);
+    memset(vga_data_array, 0, sizeof(vga_data_array));
+    vga_resume();
+}
@@ -0,0 +1,78 @@
+/**
+ * 800x600 at 60 Hz from a 16-color framebuffer
+ *
+ * 800x600 takes a 40 MHz pixel clock, so while it runs the system clock is
+ * 200 MHz and the same rgb program, at 5 clocks a pixel, keeps up. The
+ * sync_svga program makes the VESA timing: lines of 800 + 40 + 128 + 88
+ * pixels, frames of 600 + 1 + 4 + 23 lines, both syncs positive.
+ *
+ * 6-bit pixels would take 384 kB, so the framebuffer has 4 bits a pixel,
+ * two pixels a byte with the left one in the upper nibble: 240 kB, which
+ * reuses vga_data_array. The 4-bit values index a palette of 16 of the 64
+ * colors. Core 1 expands each line through the palette into a ring of
+ * SVGA_LINES line buffers in the packed format just ahead of the beam, and
+ * the DMA sends those. A line that isn't ready in time is counted by
+ * svga_late_lines(), one the rgb state machine ran out of data on by
+ * svga_underruns().
+ *
+ * svga_start() pauses the 640x480 scan-out (see vga_pause()) and takes over
+ * core 1, and svga_stop() goes back. What vga_data_array held is lost
+ * either way. The line buffers and the expansion table go in the 5760
+ * bytes of vga_data_array after the framebuffer, so they take no RAM.
+ *
+ * RESOURCES USED, while running
+ *  - PIO state machines 0 and 1 on PIO instance 1, 31 instruction slots
+ *  - DMA channels 2 and 3, DMA_IRQ_1 (end of each line)
+ *  - core 1
+ *  - the system clock, at 200 MHz, and the core voltage, at 1.15 V; both go
+ *    back to 125 MHz and the default 1.10 V in svga_stop()
+ */
+
+#ifndef SVGA_H
+#define SVGA_H
+
+#include "vga.h"
+
+#define SVGA_WIDTH 800
+#define SVGA_HEIGHT 600
+#define SVGA_ROW_BYTES 400 // 800/2
+#define SVGA_LINE_WORDS 160 // 800/5, of the lines sent
+#define SVGA_COLORS 16
+
+// Line buffers in the ring
+#define SVGA_LINES 4
+
+// Row y of the framebuffer
+static inline uint8_t *svga_row(int y)
+{
+    return (uint8_t *)vga_data_array + y * SVGA_ROW_BYTES;
+}
+
+void svga_start(void);
+void svga_stop(void);
+
+// Set palette entry index to a 6-bit color. Entries start as the 16 CGA
+// colors: bit 3 bright, bits 2-0 red, green and blue.
+void svga_set_palette(int index, char color);
+
+// Draw with palette index color, clipped to the screen
+void svga_pixel(int x, int y, int color);
+void svga_fill_rect(int x, int y, int w, int h, int color);
+
+// Lines sent since svga_start(), SVGA_HEIGHT every frame
+uint32_t svga_lines_sent(void);
+
+// Lines since svga_start() the rgb state machine ran out of data on, and
+// lines core 1 finished after they had started to be sent
+uint32_t svga_underruns(void);
+uint32_t svga_late_lines(void);
+
+// Most system clocks core 1 took to expand one line since svga_start(); a
+// line lasts 1056 * 5
+uint32_t svga_expand_cycles(void);
+
+// Expand row y of the framebuffer into a line of SVGA_LINE_WORDS words,
+// what core 1 does for every line. Only while 800x600 runs.
+void svga_expand_line(int y, uint32_t *line);
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * SWAR (SIMD within a register) operations on packed pixel words
+ *
+ * Each function works on all 5 pixels of a vga_data_array word at once,
+ * see pixel.h for the layout. Like pixel.h this only depends on the C
+ * library.
+ *
+ * The channel arithmetic treats a word as 15 2-bit channels. Pixels store
+ * each channel MSB first, so words go through vga_swar_levels() before and
+ * after to put the bits of every channel in numeric order.
+ */
+
+#ifndef SWAR_H
+#define SWAR_H
+
+#include "pixel.h"
+
+// The low 5 bits and the top bit of every 6-bit pixel field
+#define VGA_SWAR_LOW5 0x1f7df7dfu
+#define VGA_SWAR_HIGH 0x20820820u
+
+// Top bit of each pixel field set where the pixel is not 0
+static inline uint32_t vga_swar_nonzero(uint32_t w)
+{
+    // Adding 0x1f to the low 5 bits carries into the top bit when any of
+    // them is set, and never out of the field
+    return (((w & VGA_SWAR_LOW5) + VGA_SWAR_LOW5) | w) & VGA_SWAR_HIGH;
+}
+
+// Widen top-of-field flags to whole pixel masks
+static inline uint32_t vga_swar_expand(uint32_t flags)
+{
+    return (flags >> 5) * VGA_PIXEL_MASK;
+}
+
+// Mask of the pixels of w that are not the key color
+static inline uint32_t vga_swar_key_mask(uint32_t w, uint32_t key)
+{
+    return vga_swar_expand(vga_swar_nonzero(w ^ VGA_SOLID(key)));
+}
+
+// The low and the high bit of every 2-bit channel
+#define VGA_SWAR_CHANNEL_LOW 0x15555555u
+#define VGA_SWAR_CHANNEL_HIGH 0x2aaaaaaau
+
+// A levels word with every channel at intensity v (0-3)
+#define VGA_SWAR_LEVEL(v) ((uint32_t)(v) * VGA_SWAR_CHANNEL_LOW)
+
+// Swap the bits of every channel, converting between packed pixels and
+// channel intensities (the operation is its own inverse)
+static inline uint32_t vga_swar_levels(uint32_t w)
+{
+    return ((w & VGA_SWAR_CHANNEL_LOW) << 1) | ((w >> 1) & VGA_SWAR_CHANNEL_LOW);
+}
+
+// Per channel min(a + b, 3) of two levels words
+static inline uint32_t vga_swar_add_sat(uint32_t a, uint32_t b)
+{
+    // The low bits can carry into the high bit but not out of the channel
+    uint32_t sum = ((a & VGA_SWAR_CHANNEL_LOW) + (b & VGA_SWAR_CHANNEL_LOW)) ^ ((a ^ b) & VGA_SWAR_CHANNEL_HIGH);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & VGA_SWAR_CHANNEL_HIGH;
+    return sum | (carry >> 1) * 3;
+}
+
+// Per channel max(a - b, 0) of two levels words
+static inline uint32_t vga_swar_sub_sat(uint32_t a, uint32_t b)
+{
+    // Setting the high bits first keeps borrows inside the channel
+    uint32_t diff = ((a | VGA_SWAR_CHANNEL_HIGH) - (b & VGA_SWAR_CHANNEL_LOW)) ^ (~(a ^ b) & VGA_SWAR_CHANNEL_HIGH);
+    uint32_t borrow = ((~a & b) | (~(a ^ b) & diff)) & VGA_SWAR_CHANNEL_HIGH;
+    return diff & ~((borrow >> 1) * 3);
+}
+
+// Per channel (a + b) / 2 of two levels words, rounded down
+static inline uint32_t vga_swar_average(uint32_t a, uint32_t b)
+{
+    return (a & b) + (((a ^ b) & VGA_SWAR_CHANNEL_HIGH) >> 1);
+}
+
+#endif
@@ -0,0 +1,735 @@
+/**
+ * VT100/ANSI terminal on the VGA screen, see term.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+#include "gfx.h"
+#include "term.h"
+
+enum
+{
+    STATE_GROUND,
+    STATE_ESCAPE,
+    STATE_CSI,
+    STATE_STRING,     // OSC or DCS, up to BEL or ST
+    STATE_STRING_ESC, // ESC inside a string, expecting '\'
+    STATE_SKIP_ONE    // charset designation, one more byte
+};
+
+typedef struct
+{
+    uint8_t fg;
+    uint8_t bg;
+    int8_t fg_ansi; // 0-7 when fg is one of the 8 basic colors, which bold brightens
+    bool bold;
+    bool underline;
+    bool inverse;
+} attr_t;
+
+static void (*reply)(const char *s, int len);
+
+static int state;
+static int params[TERM_MAX_PARAMS];
+static int nparams;
+static char private_marker;
+static char intermediate;
+
+static int cur_x, cur_y;
+static bool wrap_pending; // the last column was just written, wrap on the next character
+static int top, bottom;   // scroll region, inclusive rows
+static bool autowrap;
+static bool cursor_visible;
+static bool cursor_drawn;
+static attr_t attr;
+
+static struct
+{
+    int x, y;
+    attr_t attr;
+} saved;
+
+// One pixel row, for inserting and deleting characters. In SCRATCH_Y next
+// to core 0's stack rather than the small RAM region.
+static uint32_t __scratch_y("term") line_buffer[VGA_LINE_WORDS];
+
+// One of the 8 basic colors at normal or bright intensity
+static uint8_t ansi_color(int i, bool bright)
+{
+    int on = bright ? 3 : 2;
+
+    if (i == 0)
+        return bright ? VGA_RGB(1, 1, 1) : 0;
+    return VGA_RGB(i & 1 ? on : 0, i & 2 ? on : 0, i & 4 ? on : 0);
+}
+
+// Nearest DAC level (see VGA_LEVEL) to an 8-bit intensity
+static int channel_level(int v)
+{
+    return v < 36 ? 0 : v < 128 ? 1 : v < 220 ? 2 : 3;
+}
+
+static uint8_t rgb_color(int r, int g, int b)
+{
+    return VGA_RGB(channel_level(r), channel_level(g), channel_level(b));
+}
+
+// xterm's 256 color palette
+static uint8_t indexed_color(int i)
+{
+    if (i < 16)
+        return ansi_color(i & 7, i >= 8);
+    if (i < 232)
+    {
+        i -= 16;
+        int r = i / 36, g = i / 6 % 6, b = i % 6;
+        return rgb_color(r ? 55 + 40 * r : 0, g ? 55 + 40 * g : 0, b ? 55 + 40 * b : 0);
+    }
+    int v = 8 + 10 * (i - 232);
+    return rgb_color(v, v, v);
+}
+
+static void reset_attr()
+{
+    attr.fg_ansi = 7;
+    attr.fg = ansi_color(7, false);
+    attr.bg = 0;
+    attr.bold = false;
+    attr.underline = false;
+    attr.inverse = false;
+}
+
+static uint8_t text_color()
+{
+    uint8_t fg = (attr.bold && attr.fg_ansi >= 0) ? ansi_color(attr.fg_ansi, true) : attr.fg;
+    return attr.inverse ? attr.bg : fg;
+}
+
+static uint8_t back_color()
+{
+    if (attr.inverse)
+        return (attr.bold && attr.fg_ansi >= 0) ? ansi_color(attr.fg_ansi, true) : attr.fg;
+    return attr.bg;
+}
+
+// Invert the bottom pixel row of the cursor's cell, twice restores it
+static void invert_cursor()
+{
+    int x0 = cur_x * FONT_WIDTH;
+    int x1 = x0 + FONT_WIDTH - 1;
+    uint32_t *row = vga_row(cur_y * FONT_HEIGHT + FONT_HEIGHT - 1);
+
+    if (x0 / 5 == x1 / 5)
+    {
+        row[x0 / 5] ^= VGA_SPAN_MASK(x0 % 5, x1 % 5);
+        return;
+    }
+    row[x0 / 5] ^= VGA_SPAN_MASK(x0 % 5, 4);
+    row[x1 / 5] ^= VGA_SPAN_MASK(0, x1 % 5);
+}
+
+// Erase columns col0..col1 of a row in the background color. The pixels
+// right of the last column are erased along with it.
+static void clear_cells(int row, int col0, int col1)
+{
+    int x = col0 * FONT_WIDTH;
+    int w = col1 == TERM_COLS - 1 ? VGA_WIDTH - x : (col1 - col0 + 1) * FONT_WIDTH;
+
+    if (col0 <= col1)
+        fillRect(x, row * FONT_HEIGHT, w, FONT_HEIGHT, attr.bg);
+}
+
+static void VGA_RAM_FUNC(clear_rows)(int row0, int row1)
+{
+    if (row0 <= row1)
+        fillRect(0, row0 * FONT_HEIGHT, VGA_WIDTH, (row1 - row0 + 1) * FONT_HEIGHT, attr.bg);
+}
+
+// Reverse the order of screen lines first..last
+static void VGA_RAM_FUNC(reverse_lines)(int first, int last)
+{
+    while (first < last)
+    {
+        uint32_t *t = vga_line_table[first];
+        vga_line_table[first++] = vga_line_table[last];
+        vga_line_table[last--] = t;
+    }
+}
+
+// Move rows row0..row1 up by n rows (down if n is negative) and clear the
+// rows that are uncovered. The rows are rotated in the line table, nothing
+// but the uncovered rows is drawn.
+static void VGA_RAM_FUNC(scroll_rows)(int row0, int row1, int n)
+{
+    int count = row1 - row0 + 1;
+
+    if (n == 0 || row0 > row1)
+        return;
+    if (n >= count || -n >= count)
+    {
+        clear_rows(row0, row1);
+        return;
+    }
+
+    int first = row0 * FONT_HEIGHT;
+    int last = (row1 + 1) * FONT_HEIGHT - 1;
+    if (n > 0)
+    {
+        int k = n * FONT_HEIGHT;
+        reverse_lines(first, first + k - 1);
+        reverse_lines(first + k, last);
+        reverse_lines(first, last);
+        clear_rows(row1 - n + 1, row1);
+    }
+    else
+    {
+        int k = -n * FONT_HEIGHT;
+        reverse_lines(first, last - k);
+        reverse_lines(last - k + 1, last);
+        reverse_lines(first, last);
+        clear_rows(row0, row0 - n - 1);
+    }
+}
+
+// Move count cells of the cursor row from column src to column dst
+static void move_cells(int src, int dst, int count)
+{
+    vga_surface_t line = {line_buffer, VGA_WIDTH, 1, VGA_LINE_WORDS};
+
+    for (int r = 0; r < FONT_HEIGHT; r++)
+    {
+        int y = cur_y * FONT_HEIGHT + r;
+        memcpy(line_buffer, vga_row(y), sizeof(line_buffer));
+        blitSurface(&line, src * FONT_WIDTH, 0, count * FONT_WIDTH, 1, dst * FONT_WIDTH, y);
+    }
+}
+
+static void VGA_RAM_FUNC(line_feed)()
+{
+    wrap_pending = false;
+    if (cur_y == bottom)
+        scroll_rows(top, bottom, 1);
+    else if (cur_y < TERM_ROWS - 1)
+        cur_y++;
+}
+
+static void reverse_index()
+{
+    wrap_pending = false;
+    if (cur_y == top)
+        scroll_rows(top, bottom, -1);
+    else if (cur_y > 0)
+        cur_y--;
+}
+
+static void move_to(int x, int y)
+{
+    cur_x = x < 0 ? 0 : x >= TERM_COLS ? TERM_COLS - 1 : x;
+    cur_y = y < 0 ? 0 : y >= TERM_ROWS ? TERM_ROWS - 1 : y;
+    wrap_pending = false;
+}
+
+static void VGA_RAM_FUNC(put_glyph)(unsigned char c)
+{
+    if (wrap_pending)
+    {
+        cur_x = 0;
+        line_feed();
+    }
+
+    int x = cur_x * FONT_WIDTH;
+    int y = cur_y * FONT_HEIGHT;
+    uint8_t fg = text_color();
+    uint8_t bg = back_color();
+
+    // drawChar() leaves the background alone when the colors are equal
+    if (fg == bg)
+        fillRect(x, y, FONT_WIDTH, FONT_HEIGHT, bg);
+    else
+        drawChar(x, y, c, fg, bg);
+    if (attr.underline)
+        drawHLine(x, y + FONT_HEIGHT - 1, FONT_WIDTH, fg);
+
+    if (cur_x < TERM_COLS - 1)
+        cur_x++;
+    else
+        wrap_pending = autowrap;
+}
+
+// Modes and attributes back to their defaults, the screen is kept
+static void soft_reset()
+{
+    top = 0;
+    bottom = TERM_ROWS - 1;
+    autowrap = true;
+    cursor_visible = true;
+    reset_attr();
+    saved.x = saved.y = 0;
+    saved.attr = attr;
+}
+
+static void reset()
+{
+    state = STATE_GROUND;
+    soft_reset();
+    move_to(0, 0);
+    clear_rows(0, TERM_ROWS - 1);
+}
+
+// Parameter i, or def if it is missing or 0
+static int param(int i, int def)
+{
+    return (i < nparams && params[i] > 0) ? params[i] : def;
+}
+
+static void select_graphic_rendition()
+{
+    if (nparams == 0)
+        nparams = 1; // CSI m is CSI 0 m
+
+    for (int i = 0; i < nparams; i++)
+    {
+        int p = params[i];
+
+        if (p == 0)
+            reset_attr();
+        else if (p == 1)
+            attr.bold = true;
+        else if (p == 22)
+            attr.bold = false;
+        else if (p == 4)
+            attr.underline = true;
+        else if (p == 24)
+            attr.underline = false;
+        else if (p == 7)
+            attr.inverse = true;
+        else if (p == 27)
+            attr.inverse = false;
+        else if (p >= 30 && p <= 37)
+        {
+            attr.fg_ansi = p - 30;
+            attr.fg = ansi_color(p - 30, false);
+        }
+        else if (p == 39)
+        {
+            attr.fg_ansi = 7;
+            attr.fg = ansi_color(7, false);
+        }
+        else if (p >= 40 && p <= 47)
+            attr.bg = ansi_color(p - 40, false);
+        else if (p == 49)
+            attr.bg = 0;
+        else if (p >= 90 && p <= 97)
+        {
+            attr.fg_ansi = -1;
+            attr.fg = ansi_color(p - 90, true);
+        }
+        else if (p >= 100 && p <= 107)
+            attr.bg = ansi_color(p - 100, true);
+        else if ((p == 38 || p == 48) && i + 1 < nparams)
+        {
+            // 38;5;n or 38;2;r;g;b, likewise 48 for the background
+            int color = -1;
+            if (params[i + 1] == 5 && i + 2 < nparams)
+            {
+                color = indexed_color(params[i + 2] & 0xff);
+                i += 2;
+            }
+            else if (params[i + 1] == 2 && i + 4 < nparams)
+            {
+                color = rgb_color(params[i + 2] & 0xff, params[i + 3] & 0xff, params[i + 4] & 0xff);
+                i += 4;
+            }
+            else
+                break;
+
+            if (p == 38)
+            {
+                attr.fg_ansi = -1;
+                attr.fg = color;
+            }
+            else
+                attr.bg = color;
+        }
+    }
+}
+
+static void send_reply(const char *s)
+{
+    if (reply)
+        reply(s, strlen(s));
+}
+
+static void set_mode(bool on)
+{
+    if (private_marker != '?')
+        return;
+    for (int i = 0; i < nparams; i++)
+    {
+        if (params[i] == 25)
+            cursor_visible = on;
+        else if (params[i] == 7)
+            autowrap = on;
+    }
+}
+
+static void csi_dispatch(char final)
+{
+    int n = param(0, 1);
+    char buf[32];
+
+    if (intermediate)
+    {
+        if (intermediate == '!' && final == 'p')
+            soft_reset(); // DECSTR
+        return;
+    }
+    if (private_marker && final != 'h' && final != 'l' && final != 'c')
+        return;
+
+    switch (final)
+    {
+    case 'A':
+        move_to(cur_x, cur_y >= top ? (cur_y - n < top ? top : cur_y - n) : cur_y - n);
+        break;
+    case 'B':
+        move_to(cur_x, cur_y <= bottom ? (cur_y + n > bottom ? bottom : cur_y + n) : cur_y + n);
+        break;
+    case 'C':
+        move_to(cur_x + n, cur_y);
+        break;
+    case 'D':
+        move_to(cur_x - n, cur_y);
+        break;
+    case 'E':
+        move_to(0, cur_y + n);
+        break;
+    case 'F':
+        move_to(0, cur_y - n);
+        break;
+    case 'G':
+    case '`':
+        move_to(n - 1, cur_y);
+        break;
+    case 'H':
+    case 'f':
+        move_to(param(1, 1) - 1, n - 1);
+        break;
+    case 'd':
+        move_to(cur_x, n - 1);
+        break;
+    case 'J':
+        if (param(0, 0) == 0)
+        {
+            clear_cells(cur_y, cur_x, TERM_COLS - 1);
+            clear_rows(cur_y + 1, TERM_ROWS - 1);
+        }
+        else if (param(0, 0) == 1)
+        {
+            clear_rows(0, cur_y - 1);
+            clear_cells(cur_y, 0, cur_x);
+        }
+        else
+            clear_rows(0, TERM_ROWS - 1);
+        break;
+    case 'K':
+        if (param(0, 0) == 0)
+            clear_cells(cur_y, cur_x, TERM_COLS - 1);
+        else if (param(0, 0) == 1)
+            clear_cells(cur_y, 0, cur_x);
+        else
+            clear_cells(cur_y, 0, TERM_COLS - 1);
+        break;
+    case 'X':
+        clear_cells(cur_y, cur_x, cur_x + n - 1 < TERM_COLS ? cur_x + n - 1 : TERM_COLS - 1);
+        break;
+    case '@':
+        if (n > TERM_COLS - cur_x)
+            n = TERM_COLS - cur_x;
+        move_cells(cur_x, cur_x + n, TERM_COLS - cur_x - n);
+        clear_cells(cur_y, cur_x, cur_x + n - 1);
+        break;
+    case 'P':
+        if (n > TERM_COLS - cur_x)
+            n = TERM_COLS - cur_x;
+        move_cells(cur_x + n, cur_x, TERM_COLS - cur_x - n);
+        clear_cells(cur_y, TERM_COLS - n, TERM_COLS - 1);
+        break;
+    case 'L':
+        if (cur_y >= top && cur_y <= bottom)
+        {
+            scroll_rows(cur_y, bottom, -n);
+            cur_x = 0;
+        }
+        break;
+    case 'M':
+        if (cur_y >= top && cur_y <= bottom)
+        {
+            scroll_rows(cur_y, bottom, n);
+            cur_x = 0;
+        }
+        break;
+    case 'S':
+        scroll_rows(top, bottom, n);
+        break;
+    case 'T':
+        scroll_rows(top, bottom, -n);
+        break;
+    case 'r':
+    {
+        int t = param(0, 1) - 1;
+        int b = param(1, TERM_ROWS) - 1;
+        if (b >= TERM_ROWS)
+            b = TERM_ROWS - 1;
+        if (t < b)
+        {
+            top = t;
+            bottom = b;
+            move_to(0, 0);
+        }
+        break;
+    }
+    case 's':
+        saved.x = cur_x;
+        saved.y = cur_y;
+        break;
+    case 'u':
+        move_to(saved.x, saved.y);
+        break;
+    case 'm':
+        select_graphic_rendition();
+        break;
+    case 'n':
+        if (param(0, 0) == 5)
+            send_reply("\033[0n");
+        else if (param(0, 0) == 6)
+        {
+            snprintf(buf, sizeof(buf), "\033[%d;%dR", cur_y + 1, cur_x + 1);
+            send_reply(buf);
+        }
+        break;
+    case 'c':
+        if (private_marker == '>')
+            send_reply("\033[>0;0;0c");
+        else if (!private_marker)
+            send_reply("\033[?1;0c"); // VT100 without options
+        break;
+    case 'h':
+        set_mode(true);
+        break;
+    case 'l':
+        set_mode(false);
+        break;
+    }
+}
+
+static void esc_dispatch(unsigned char c)
+{
+    state = STATE_GROUND;
+
+    switch (c)
+    {
+    case '[':
+        state = STATE_CSI;
+        nparams = 0;
+        params[0] = 0;
+        private_marker = 0;
+        intermediate = 0;
+        break;
+    case ']':
+    case 'P':
+    case '_':
+    case '^':
+        state = STATE_STRING;
+        break;
+    case '(':
+    case ')':
+    case '*':
+    case '+':
+    case '#':
+        state = STATE_SKIP_ONE;
+        break;
+    case '7':
+        saved.x = cur_x;
+        saved.y = cur_y;
+        saved.attr = attr;
+        break;
+    case '8':
+        move_to(saved.x, saved.y);
+        attr = saved.attr;
+        break;
+    case 'D':
+        line_feed();
+        break;
+    case 'E':
+        cur_x = 0;
+        line_feed();
+        break;
+    case 'M':
+        reverse_index();
+        break;
+    case 'c':
+        reset();
+        break;
+    }
+}
+
+// C0 control characters, which also act in the middle of a sequence
+static void control(unsigned char c)
+{
+    switch (c)
+    {
+    case '\b':
+        if (cur_x > 0)
+            cur_x--;
+        wrap_pending = false;
+        break;
+    case '\t':
+        move_to((cur_x / 8 + 1) * 8, cur_y);
+        break;
+    case '\n':
+    case '\v':
+    case '\f':
+        line_feed();
+        break;
+    case '\r':
+        cur_x = 0;
+        wrap_pending = false;
+        break;
+    case 0x18: // CAN
+    case 0x1a: // SUB
+        state = STATE_GROUND;
+        break;
+    case 0x1b:
+        state = STATE_ESCAPE;
+        break;
+    }
+}
+
+static void csi_byte(unsigned char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        if (nparams == 0)
+            nparams = 1;
+        int *p = &params[nparams - 1];
+        if (*p < 10000)
+            *p = *p * 10 + (c - '0');
+    }
+    else if (c == ';' || c == ':')
+    {
+        if (nparams == 0)
+            nparams = 1;
+        if (nparams < TERM_MAX_PARAMS)
+            params[nparams++] = 0;
+    }
+    else if (c >= '<' && c <= '?')
+        private_marker = c;
+    else if (c >= 0x20 && c <= 0x2f)
+        intermediate = c;
+    else if (c >= 0x40 && c <= 0x7e)
+    {
+        state = STATE_GROUND;
+        csi_dispatch(c);
+    }
+}
+
+static void feed(unsigned char c)
+{
+    if (c < 0x20 && !(state == STATE_STRING && c == 0x1b))
+    {
+        if (c == 0x07 && (state == STATE_STRING || state == STATE_STRING_ESC))
+            state = STATE_GROUND; // BEL ends an OSC
+        else if (state != STATE_STRING)
+            control(c);
+        return;
+    }
+
+    switch (state)
+    {
+    case STATE_GROUND:
+        // UTF-8 lead bytes are shown as '?', continuation bytes skipped
+        if (c >= 0x80 && (c & 0xc0) != 0x80)
+            put_glyph('?');
+        break;
+    case STATE_ESCAPE:
+        esc_dispatch(c);
+        break;
+    case STATE_CSI:
+        csi_byte(c);
+        break;
+    case STATE_STRING:
+        if (c == 0x1b)
+            state = STATE_STRING_ESC;
+        break;
+    case STATE_STRING_ESC:
+        if (c == '\\')
+            state = STATE_GROUND;
+        else
+        {
+            state = STATE_ESCAPE;
+            esc_dispatch(c);
+        }
+        break;
+    case STATE_SKIP_ONE:
+        state = STATE_GROUND;
+        break;
+    }
+}
+
+void term_init(void (*reply_fn)(const char *s, int len))
+{
+    reply = reply_fn;
+    cursor_drawn = false;
+    reset();
+}
+
+void VGA_RAM_FUNC(term_write)(const char *s, int len)
+{
+    if (cursor_drawn)
+        invert_cursor();
+
+    for (int i = 0; i < len; i++)
+    {
+        unsigned char c = s[i];
+
+        // Printable ASCII is most of the traffic
+        if (state == STATE_GROUND && c >= 0x20 && c < 0x7f)
+            put_glyph(c);
+        else
+            feed(c);
+    }
+
+    cursor_drawn = cursor_visible;
+    if (cursor_drawn)
+        invert_cursor();
+}
+
+static void usb_reply(const char *s, int len)
+{
+    for (int i = 0; i < len; i++)
+        putchar_raw(s[i]);
+    stdio_flush();
+}
+
+void term_run()
+{
+    char buf[TERM_CHUNK];
+
+    term_init(usb_reply);
+    while (true)
+    {
+        // A block at a time, getchar_timeout_us() per byte could not keep up
+        // with USB full speed
+        int n = stdio_usb.in_chars(buf, sizeof(buf));
+        if (n > 0)
+        {
+            // A boot pattern makes way for the terminal on the first input
+            if (vga_test_pattern() != VGA_TEST_NONE)
+                vga_show_test_pattern(VGA_TEST_NONE, 0, 0);
+            term_write(buf, n);
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * VT100/ANSI terminal on the VGA screen
+ *
+ * 106 columns by 60 rows of the 6x8 font. Understands the usual subset of
+ * ECMA-48 and xterm sequences that shells, editors and curses programs emit:
+ *  - C0 controls: BS, HT, LF, VT, FF, CR, BEL (ignored), CAN/SUB
+ *  - ESC 7 8 D E M c, charset selection (ignored)
+ *  - CSI A B C D E F G H f d J K X @ P L M S T r s u m n c h l (?25, ?7)
+ *  - SGR 0 1 4 7 22 24 27, 30-37 40-47 90-97 100-107 39 49,
+ *    38/48;5;n and 38/48;2;r;g;b, all mapped to the 64-color palette
+ *  - OSC and DCS strings are skipped
+ * Other UTF-8 characters are shown as '?'.
+ *
+ * There is no cell buffer, the screen is the only state. Scrolling permutes
+ * vga_line_table instead of moving pixels, so a scroll costs a few hundred
+ * pointer swaps plus clearing the new line.
+ */
+
+#ifndef TERM_H
+#define TERM_H
+
+#include "font.h"
+#include "vga.h"
+
+#define TERM_COLS (VGA_WIDTH / FONT_WIDTH)   // 106
+#define TERM_ROWS (VGA_HEIGHT / FONT_HEIGHT) // 60
+
+// Most numeric parameters kept for one control sequence
+#define TERM_MAX_PARAMS 16
+
+// Bytes read from USB at a time by term_run()
+#define TERM_CHUNK 256
+
+// Clear the screen and reset all modes. Answers to status queries (CSI n,
+// CSI c) are passed to reply, which may be NULL.
+void term_init(void (*reply)(const char *s, int len));
+
+// Interpret a block of output
+void term_write(const char *s, int len);
+
+// Show everything received on USB serial, forever. Never returning lets
+// the demo and benchmarks drop out of the link.
+void term_run(void) __attribute__((noreturn));
+
+#endif
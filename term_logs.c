@@ -0,0 +1,1351 @@
+/**
+ * Recorded terminal output for the terminal benchmark, see term_logs.h
+ *
+ * Newlines are stored as CR LF, the way a tty sends them.
+ *
+ *  ls         ls --color=always -l /usr/bin | head -300
+ *  diff       git diff --color=always of the first drawing changes, cut at 24000 bytes
+ *  dashboard  a status screen redrawn in place above a scrolling log region, 30 updates
+ */
+
+#include "term_logs.h"
+
+static const char log_ls[] =
+    "total 261032\r\n"
+    "lrwxrwxrwx 1 root root         28 Feb 17  2023 \033[0m\033[01;36mFileCheck-14\033[0m -> ../lib/l"
+    "lvm-14/bin/FileCheck\r\n"
+    "lrwxrwxrwx 1 root root          1 Aug 18  2021 \033[01;36mX11\033[0m -> .\r\n"
+    "-rwxr-xr-x 1 root root      68496 Sep 20  2022 \033[01;32m[\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         25 Mar 18  2022 \033[01;36maclocal\033[0m -> /etc/alternatives/ac"
+    "local\r\n"
+    "-rwxr-xr-x 1 root root      36020 Mar 18  2022 \033[01;32maclocal-1.16\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       3472 May 26  2022 \033[01;32mactivate-global-python-argcomplete\033"
+    "[0m\r\n"
+    "-rwxr-xr-x 1 root root      14439 May 17  2024 \033[01;32madd-apt-repository\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      31040 Nov 21  2024 \033[01;32maddpart\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         26 Jan 14  2023 \033[01;36maddr2line\033[0m -> x86_64-linux-gnu-a"
+    "ddr2line\r\n"
+    "-rwxr-xr-x 1 root root       1887 Mar 23  2023 \033[01;32maggregate_profile\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     131192 May 28  2023 \033[01;32mappstreamcli\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      18752 May 25  2023 \033[01;32mapt\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         18 May 17  2024 \033[01;36mapt-add-repository\033[0m -> add-apt-r"
+    "epository\r\n"
+    "-rwxr-xr-x 1 root root      88456 May 25  2023 \033[01;32mapt-cache\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      22920 May 25  2023 \033[01;32mapt-cdrom\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      26944 May 25  2023 \033[01;32mapt-config\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      51592 May 25  2023 \033[01;32mapt-get\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27972 May 25  2023 \033[01;32mapt-key\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      59784 May 25  2023 \033[01;32mapt-mark\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         19 Jan 14  2023 \033[01;36mar\033[0m -> x86_64-linux-gnu-ar\r\n"
+    "-rwxr-xr-x 1 root root      43888 Sep 20  2022 \033[01;32march\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         19 Jan 14  2023 \033[01;36mas\033[0m -> x86_64-linux-gnu-as\r\n"
+    "-rwxr-xr-x 1 root root      15204 Jan 14  2023 \033[01;32mautoconf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       9034 Jan 14  2023 \033[01;32mautoheader\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      33475 Jan 14  2023 \033[01;32mautom4te\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         26 Mar 18  2022 \033[01;36mautomake\033[0m -> /etc/alternatives/a"
+    "utomake\r\n"
+    "-rwxr-xr-x 1 root root     262055 Mar 18  2022 \033[01;32mautomake-1.16\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      26934 Jan 14  2023 \033[01;32mautoreconf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      17177 Jan 14  2023 \033[01;32mautoscan\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      34017 Jan 14  2023 \033[01;32mautoupdate\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         21 Jun 17  2022 \033[01;36mawk\033[0m -> /etc/alternatives/awk\r\n"
+    "-rwxr-xr-x 1 root root     250800 May 19  2023 \033[01;32mb2\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      60400 Sep 20  2022 \033[01;32mb2sum\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48016 Sep 20  2022 \033[01;32mbase32\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48016 Sep 20  2022 \033[01;32mbase64\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      43856 Sep 20  2022 \033[01;32mbasename\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      56208 Sep 20  2022 \033[01;32mbasenc\033[0m\r\n"
+    "-rwxr-xr-x 1 root root    1265648 Jun  6  2025 \033[01;32mbash\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6865 Jun  6  2025 \033[01;32mbashbug\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     699304 May 19  2023 \033[01;32mbcp\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     549664 Sep 18  2022 \033[01;32mbison\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       4214 Sep 18  2022 \033[01;32mbison.yacc\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          2 May 19  2023 \033[01;36mbjam\033[0m -> b2\r\n"
+    "lrwxrwxrwx 1 root root         27 Sep 29  2023 \033[01;36mbugpoint\033[0m -> ../lib/llvm-14/bin/"
+    "bugpoint\r\n"
+    "lrwxrwxrwx 1 root root         27 Feb 17  2023 \033[01;36mbugpoint-14\033[0m -> ../lib/llvm-14/b"
+    "in/bugpoint\r\n"
+    "-rwxr-xr-x 3 root root      39224 Sep 19  2022 \033[01;32mbunzip2\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      92672 Jun 26  2025 \033[01;32mbusctl\033[0m\r\n"
+    "-rwxr-xr-x 3 root root      39224 Sep 19  2022 \033[01;32mbzcat\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Sep 19  2022 \033[01;36mbzcmp\033[0m -> bzdiff\r\n"
+    "-rwxr-xr-x 1 root root       2225 Sep 19  2022 \033[01;32mbzdiff\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Sep 19  2022 \033[01;36mbzegrep\033[0m -> bzgrep\r\n"
+    "-rwxr-xr-x 1 root root       4893 Nov 27  2021 \033[01;32mbzexe\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Sep 19  2022 \033[01;36mbzfgrep\033[0m -> bzgrep\r\n"
+    "-rwxr-xr-x 1 root root       3775 Sep 19  2022 \033[01;32mbzgrep\033[0m\r\n"
+    "-rwxr-xr-x 3 root root      39224 Sep 19  2022 \033[01;32mbzip2\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14568 Sep 19  2022 \033[01;32mbzip2recover\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Sep 19  2022 \033[01;36mbzless\033[0m -> bzmore\r\n"
+    "-rwxr-xr-x 1 root root       1297 Sep 19  2022 \033[01;32mbzmore\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         21 Jan  8  2023 \033[01;36mc++\033[0m -> /etc/alternatives/c++\r\n"
+    "lrwxrwxrwx 1 root root         24 Jan 14  2023 \033[01;36mc++filt\033[0m -> x86_64-linux-gnu-c++"
+    "filt\r\n"
+    "lrwxrwxrwx 1 root root         21 Nov 17  2020 \033[01;36mc89\033[0m -> /etc/alternatives/c89\r\n"
+    "-rwxr-xr-x 1 root root        428 Nov 17  2020 \033[01;32mc89-gcc\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         21 Nov 17  2020 \033[01;36mc99\033[0m -> /etc/alternatives/c99\r\n"
+    "-rwxr-xr-x 1 root root        454 Nov 17  2020 \033[01;32mc99-gcc\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6894 Sep 26  2025 \033[01;32mc_rehash\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         21 Mar 23  2023 \033[01;36mcaf\033[0m -> /etc/alternatives/caf\r\n"
+    "lrwxrwxrwx 1 root root         29 Mar 23  2023 \033[01;36mcaf.openmpi\033[0m -> /etc/alternative"
+    "s/caf-openmpi\r\n"
+    "lrwxrwxrwx 1 root root         24 Mar 23  2023 \033[01;36mcafrun\033[0m -> /etc/alternatives/caf"
+    "run\r\n"
+    "lrwxrwxrwx 1 root root         32 Mar 23  2023 \033[01;36mcafrun.openmpi\033[0m -> /etc/alternat"
+    "ives/cafrun-openmpi\r\n"
+    "lrwxrwxrwx 1 root root          3 May  7  2023 \033[01;36mcaptoinfo\033[0m -> tic\r\n"
+    "-rwxr-xr-x 1 root root   12270544 Jan 11  2023 \033[01;32mcargo\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      44016 Sep 20  2022 \033[01;32mcat\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         20 Jan  8  2023 \033[01;36mcc\033[0m -> /etc/alternatives/cc\r\n"
+    "-rwxr-sr-x 1 root shadow    80376 Apr  7  2025 \033[30;43mchage\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14584 Jun  6  2025 \033[01;32mchattr\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      68720 Sep 20  2022 \033[01;32mchcon\033[0m\r\n"
+    "-rwsr-xr-x 1 root root      62672 Apr  7  2025 \033[37;41mchfn\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      68656 Sep 20  2022 \033[01;32mchgrp\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      64496 Sep 20  2022 \033[01;32mchmod\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      55616 Nov 21  2024 \033[01;32mchoom\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      72752 Sep 20  2022 \033[01;32mchown\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      67904 Nov 21  2024 \033[01;32mchrt\033[0m\r\n"
+    "-rwsr-xr-x 1 root root      52880 Apr  7  2025 \033[37;41mchsh\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     142384 Sep 20  2022 \033[01;32mcksum\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14584 May  7  2023 \033[01;32mclear\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14488 Jun  6  2025 \033[01;32mclear_console\033[0m\r\n"
+    "-rwxr-xr-x 1 root root    9245840 Nov 30  2022 \033[01;32mcmake\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      52176 Feb  3  2023 \033[01;32mcmp\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48048 Sep 20  2022 \033[01;32mcomm\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      15375 Aug 29  2025 \033[01;32mcorelist\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         45 Sep  3  2025 \033[01;36mcorepack\033[0m -> ../lib/node_modules"
+    "/corepack/dist/corepack.js\r\n"
+    "lrwxrwxrwx 1 root root         24 Feb 17  2023 \033[01;36mcount-14\033[0m -> ../lib/llvm-14/bin/"
+    "count\r\n"
+    "-rwxr-xr-x 1 root root     151152 Sep 20  2022 \033[01;32mcp\033[0m\r\n"
+    "-rwxr-xr-x 1 root root    9544272 Nov 30  2022 \033[01;32mcpack\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       8360 Aug 29  2025 \033[01;32mcpan\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       8381 Aug 29  2025 \033[01;32mcpan5.36-x86_64-linux-gnu\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Jan  8  2023 \033[01;36mcpp\033[0m -> cpp-12\r\n"
+    "lrwxrwxrwx 1 root root         23 Apr  7  2025 \033[01;36mcpp-12\033[0m -> x86_64-linux-gnu-cpp-"
+    "12\r\n"
+    "-rwxr-xr-x 1 root root     122032 Sep 20  2022 \033[01;32mcsplit\033[0m\r\n"
+    "-rwxr-xr-x 1 root root   10697872 Nov 30  2022 \033[01;32mctest\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 May 22  2023 \033[01;36mctstat\033[0m -> lnstat\r\n"
+    "-rwxr-xr-x 1 root root     280800 Jul 19  2025 \033[01;32mcurl\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6469 Jul 19  2025 \033[01;32mcurl-config\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48112 Sep 20  2022 \033[01;32mcut\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     125640 Jan  5  2023 \033[01;32mdash\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     121904 Sep 20  2022 \033[01;32mdate\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14560 Sep 16  2023 \033[01;32mdbus-cleanup-sockets\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     244288 Sep 16  2023 \033[01;32mdbus-daemon\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      26856 Sep 16  2023 \033[01;32mdbus-monitor\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14568 Sep 16  2023 \033[01;32mdbus-run-session\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      30944 Sep 16  2023 \033[01;32mdbus-send\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14560 Sep 16  2023 \033[01;32mdbus-update-activation-environment\033"
+    "[0m\r\n"
+    "-rwxr-xr-x 1 root root      14560 Sep 16  2023 \033[01;32mdbus-uuidgen\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      89240 Sep 20  2022 \033[01;32mdd\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      24358 Jul 13  2022 \033[01;32mdeb-systemd-helper\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6241 Aug 20  2025 \033[01;32mdeb-systemd-invoke\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       2859 Jan  8  2023 \033[01;32mdebconf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      11541 Jan  8  2023 \033[01;32mdebconf-apt-progress\033[0m\r\n"
+    "-rwxr-xr-x 1 root root        608 Jan  8  2023 \033[01;32mdebconf-communicate\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       1719 Jan  8  2023 \033[01;32mdebconf-copydb\033[0m\r\n"
+    "-rwxr-xr-x 1 root root        647 Jan  8  2023 \033[01;32mdebconf-escape\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       2995 Jan  8  2023 \033[01;32mdebconf-set-selections\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       1827 Jan  8  2023 \033[01;32mdebconf-show\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      31040 Nov 21  2024 \033[01;32mdelpart\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      23352 Jun 22  2025 \033[01;32mderb\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     102200 Sep 20  2022 \033[01;32mdf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       1836 Jan 31  2022 \033[01;32mdh_autotools-dev_restoreconfig\033[0m\r"
+    "\n"
+    "-rwxr-xr-x 1 root root       1850 Jan 31  2022 \033[01;32mdh_autotools-dev_updateconfig\033[0m\r"
+    "\n"
+    "-rwxr-xr-x 1 root root       9444 Feb 27  2019 \033[01;32mdh_installxmlcatalogs\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     155216 Feb  3  2023 \033[01;32mdiff\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      68752 Feb  3  2023 \033[01;32mdiff3\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     151344 Sep 20  2022 \033[01;32mdir\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      52144 Sep 20  2022 \033[01;32mdircolors\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     600200 Jun 21  2025 \033[01;32mdirmngr\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     109432 Jun 21  2025 \033[01;32mdirmngr-client\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      39760 Sep 20  2022 \033[01;32mdirname\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      88656 Nov 21  2024 \033[01;32mdmesg\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          8 Dec 19  2022 \033[01;36mdnsdomainname\033[0m -> hostname\r\n"
+    "lrwxrwxrwx 1 root root          8 Dec 19  2022 \033[01;36mdomainname\033[0m -> hostname\r\n"
+    "-rwxr-xr-x 1 root root     318096 May 11  2023 \033[01;32mdpkg\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      15202 May 11  2023 \033[01;32mdpkg-architecture\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       8335 May 11  2023 \033[01;32mdpkg-buildflags\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      33409 May 11  2023 \033[01;32mdpkg-buildpackage\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       7624 May 11  2023 \033[01;32mdpkg-checkbuilddeps\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     170512 May 11  2023 \033[01;32mdpkg-deb\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       2783 May 11  2023 \033[01;32mdpkg-distaddfile\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     158264 May 11  2023 \033[01;32mdpkg-divert\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      18921 May 11  2023 \033[01;32mdpkg-genbuildinfo\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      17809 May 11  2023 \033[01;32mdpkg-genchanges\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14538 May 11  2023 \033[01;32mdpkg-gencontrol\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      10906 May 11  2023 \033[01;32mdpkg-gensymbols\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      21206 May 11  2023 \033[01;32mdpkg-maintscript-helper\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       9095 May 11  2023 \033[01;32mdpkg-mergechangelogs\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6776 May 11  2023 \033[01;32mdpkg-name\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       4947 May 11  2023 \033[01;32mdpkg-parsechangelog\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     162384 May 11  2023 \033[01;32mdpkg-query\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       4186 May 11  2023 \033[01;32mdpkg-realpath\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       8669 May 11  2023 \033[01;32mdpkg-scanpackages\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       9200 May 11  2023 \033[01;32mdpkg-scansources\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      31914 May 11  2023 \033[01;32mdpkg-shlibdeps\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      23457 May 11  2023 \033[01;32mdpkg-source\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     129520 May 11  2023 \033[01;32mdpkg-split\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      63824 May 11  2023 \033[01;32mdpkg-statoverride\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      88560 May 11  2023 \033[01;32mdpkg-trigger\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       3256 May 11  2023 \033[01;32mdpkg-vendor\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         27 Sep 29  2023 \033[01;36mdsymutil\033[0m -> ../lib/llvm-14/bin/"
+    "dsymutil\r\n"
+    "lrwxrwxrwx 1 root root         27 Feb 17  2023 \033[01;36mdsymutil-14\033[0m -> ../lib/llvm-14/b"
+    "in/dsymutil\r\n"
+    "-rwxr-xr-x 1 root root     175440 Sep 20  2022 \033[01;32mdu\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      18672 Nov 19  2022 \033[01;32mdumpsexp\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         20 Jan 14  2023 \033[01;36mdwp\033[0m -> x86_64-linux-gnu-dwp\r\n"
+    "-rwxr-xr-x 1 root root      43856 Sep 20  2022 \033[01;32mecho\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         24 Feb 16  2025 \033[01;36meditor\033[0m -> /etc/alternatives/edi"
+    "tor\r\n"
+    "-rwxr-xr-x 1 root root         41 Jan 24  2023 \033[01;32megrep\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         24 Jan 14  2023 \033[01;36melfedit\033[0m -> x86_64-linux-gnu-elf"
+    "edit\r\n"
+    "-rwxr-xr-x 1 root root      41947 Aug 29  2025 \033[01;32menc2xs\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       3069 Aug 29  2025 \033[01;32mencguess\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48536 Sep 20  2022 \033[01;32menv\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         20 Feb 16  2025 \033[01;36mex\033[0m -> /etc/alternatives/ex\r\n"
+    "-rwxr-xr-x 1 root root      43952 Sep 20  2022 \033[01;32mexpand\033[0m\r\n"
+    "-rwxr-sr-x 1 root shadow    31184 Apr  7  2025 \033[30;43mexpiry\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     117808 Sep 20  2022 \033[01;32mexpr\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         21 Jan  8  2023 \033[01;36mf77\033[0m -> /etc/alternatives/f77\r\n"
+    "lrwxrwxrwx 1 root root         21 Jan  8  2023 \033[01;36mf95\033[0m -> /etc/alternatives/f95\r\n"
+    "-rwxr-xr-x 1 root root      85200 Sep 20  2022 \033[01;32mfactor\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      23072 Apr  7  2025 \033[01;32mfaillog\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35592 Mar 18  2023 \033[01;32mfaked-sysv\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35616 Mar 18  2023 \033[01;32mfaked-tcp\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         26 Mar 18  2023 \033[01;36mfakeroot\033[0m -> /etc/alternatives/f"
+    "akeroot\r\n"
+    "-rwxr-xr-x 1 root root       3995 Mar 18  2023 \033[01;32mfakeroot-sysv\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       3990 Mar 18  2023 \033[01;32mfakeroot-tcp\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35136 Nov 21  2024 \033[01;32mfallocate\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35664 Sep 20  2022 \033[01;32mfalse\033[0m\r\n"
+    "-rwxr-xr-x 1 root root         41 Jan 24  2023 \033[01;32mfgrep\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27120 Jan 28  2023 \033[01;32mfile\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35184 Nov 21  2024 \033[01;32mfincore\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     224848 Jan  8  2023 \033[01;32mfind\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      85600 Nov 21  2024 \033[01;32mfindmnt\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35216 Nov 21  2024 \033[01;32mflock\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48016 Sep 20  2022 \033[01;32mfmt\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      43920 Sep 20  2022 \033[01;32mfold\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      26936 Dec 19  2022 \033[01;32mfree\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      23000 Feb 19  2023 \033[01;32mfunzip\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      40784 Dec 13  2022 \033[01;32mfuser\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Jan  8  2023 \033[01;36mg++\033[0m -> g++-12\r\n"
+    "lrwxrwxrwx 1 root root         23 Apr  7  2025 \033[01;36mg++-12\033[0m -> x86_64-linux-gnu-g++-"
+    "12\r\n"
+    "-rwxr-xr-x 1 root root      22848 Aug 18  2025 \033[01;32mgapplication\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          6 Jan  8  2023 \033[01;36mgcc\033[0m -> gcc-12\r\n"
+    "lrwxrwxrwx 1 root root         23 Apr  7  2025 \033[01;36mgcc-12\033[0m -> x86_64-linux-gnu-gcc-"
+    "12\r\n"
+    "lrwxrwxrwx 1 root root          9 Jan  8  2023 \033[01;36mgcc-ar\033[0m -> gcc-ar-12\r\n"
+    "lrwxrwxrwx 1 root root         26 Apr  7  2025 \033[01;36mgcc-ar-12\033[0m -> x86_64-linux-gnu-g"
+    "cc-ar-12\r\n"
+    "lrwxrwxrwx 1 root root          9 Jan  8  2023 \033[01;36mgcc-nm\033[0m -> gcc-nm-12\r\n"
+    "lrwxrwxrwx 1 root root         26 Apr  7  2025 \033[01;36mgcc-nm-12\033[0m -> x86_64-linux-gnu-g"
+    "cc-nm-12\r\n"
+    "lrwxrwxrwx 1 root root         13 Jan  8  2023 \033[01;36mgcc-ranlib\033[0m -> gcc-ranlib-12\r\n"
+    "lrwxrwxrwx 1 root root         30 Apr  7  2025 \033[01;36mgcc-ranlib-12\033[0m -> x86_64-linux-g"
+    "nu-gcc-ranlib-12\r\n"
+    "lrwxrwxrwx 1 root root          7 Jan  8  2023 \033[01;36mgcov\033[0m -> gcov-12\r\n"
+    "lrwxrwxrwx 1 root root         24 Apr  7  2025 \033[01;36mgcov-12\033[0m -> x86_64-linux-gnu-gco"
+    "v-12\r\n"
+    "lrwxrwxrwx 1 root root         12 Jan  8  2023 \033[01;36mgcov-dump\033[0m -> gcov-dump-12\r\n"
+    "lrwxrwxrwx 1 root root         29 Apr  7  2025 \033[01;36mgcov-dump-12\033[0m -> x86_64-linux-gn"
+    "u-gcov-dump-12\r\n"
+    "lrwxrwxrwx 1 root root         12 Jan  8  2023 \033[01;36mgcov-tool\033[0m -> gcov-tool-12\r\n"
+    "lrwxrwxrwx 1 root root         29 Apr  7  2025 \033[01;36mgcov-tool-12\033[0m -> x86_64-linux-gn"
+    "u-gcov-tool-12\r\n"
+    "-rwxr-xr-x 1 root root      51520 Aug 18  2025 \033[01;32mgdbus\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      19168 Jun 22  2025 \033[01;32mgenbrk\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27392 Aug 25  2025 \033[01;32mgencat\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      15024 Jun 22  2025 \033[01;32mgencfu\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27200 Jun 22  2025 \033[01;32mgencnval\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27432 Jun 22  2025 \033[01;32mgendict\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     172008 Jun 22  2025 \033[01;32mgenrb\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      27136 Aug 25  2025 \033[01;32mgetconf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      36320 Aug 25  2025 \033[01;32mgetent\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35136 Nov 21  2024 \033[01;32mgetopt\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         11 Jan  8  2023 \033[01;36mgfortran\033[0m -> gfortran-12\r\n"
+    "lrwxrwxrwx 1 root root         28 Apr  7  2025 \033[01;36mgfortran-12\033[0m -> x86_64-linux-gnu"
+    "-gfortran-12\r\n"
+    "-rwxr-xr-x 1 root root      92496 Aug 18  2025 \033[01;32mgio\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         49 Aug 18  2025 \033[01;36mgio-querymodules\033[0m -> ../lib/x86_"
+    "64-linux-gnu/glib-2.0/gio-querymodules\r\n"
+    "-rwxr-xr-x 1 root root    3713416 Jan 11  2025 \033[01;32mgit\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          3 Jan 11  2025 \033[01;36mgit-receive-pack\033[0m -> git\r\n"
+    "-rwxr-xr-x 1 root root    2141792 Jan 11  2025 \033[01;32mgit-shell\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          3 Jan 11  2025 \033[01;36mgit-upload-archive\033[0m -> git\r\n"
+    "lrwxrwxrwx 1 root root          3 Jan 11  2025 \033[01;36mgit-upload-pack\033[0m -> git\r\n"
+    "lrwxrwxrwx 1 root root         53 Aug 18  2025 \033[01;36mglib-compile-schemas\033[0m -> ../lib/"
+    "x86_64-linux-gnu/glib-2.0/glib-compile-schemas\r\n"
+    "lrwxrwxrwx 1 root root          4 Apr 10  2021 \033[01;36mgmake\033[0m -> make\r\n"
+    "lrwxrwxrwx 1 root root         21 Jan 14  2023 \033[01;36mgold\033[0m -> x86_64-linux-gnu-gold\r"
+    "\n"
+    "lrwxrwxrwx 1 root root         27 Jan 14  2023 \033[01;36mgp-archive\033[0m -> x86_64-linux-gnu-"
+    "gp-archive\r\n"
+    "lrwxrwxrwx 1 root root         31 Jan 14  2023 \033[01;36mgp-collect-app\033[0m -> x86_64-linux-"
+    "gnu-gp-collect-app\r\n"
+    "lrwxrwxrwx 1 root root         32 Jan 14  2023 \033[01;36mgp-display-html\033[0m -> x86_64-linux"
+    "-gnu-gp-display-html\r\n"
+    "lrwxrwxrwx 1 root root         31 Jan 14  2023 \033[01;36mgp-display-src\033[0m -> x86_64-linux-"
+    "gnu-gp-display-src\r\n"
+    "lrwxrwxrwx 1 root root         32 Jan 14  2023 \033[01;36mgp-display-text\033[0m -> x86_64-linux"
+    "-gnu-gp-display-text\r\n"
+    "-rwsr-xr-x 1 root root      88496 Apr  7  2025 \033[37;41mgpasswd\033[0m\r\n"
+    "-rwxr-xr-x 1 root root    1108440 Jun 21  2025 \033[01;32mgpg\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     435424 Jun 21  2025 \033[01;32mgpg-agent\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     158680 Jun 21  2025 \033[01;32mgpg-connect-agent\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     207872 Jun 21  2025 \033[01;32mgpg-wks-server\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       3516 Jun 21  2025 \033[01;32mgpg-zip\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     932120 Jun 21  2025 \033[01;32mgpgcompose\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     178928 Jun 21  2025 \033[01;32mgpgconf\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35128 Jun 21  2025 \033[01;32mgpgparsemail\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      13601 Oct 18  2022 \033[01;32mgpgrt-config\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     540320 Jun 21  2025 \033[01;32mgpgsm\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      76352 Jun 21  2025 \033[01;32mgpgsplit\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     151064 Jun 21  2025 \033[01;32mgpgtar\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     474112 Jun 21  2025 \033[01;32mgpgv\033[0m\r\n"
+    "lrwxrwxrwx 1 root root         22 Jan 14  2023 \033[01;36mgprof\033[0m -> x86_64-linux-gnu-gprof"
+    "\r\n"
+    "lrwxrwxrwx 1 root root         24 Jan 14  2023 \033[01;36mgprofng\033[0m -> x86_64-linux-gnu-gpr"
+    "ofng\r\n"
+    "-rwxr-xr-x 1 root root     203152 Jan 24  2023 \033[01;32mgrep\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      22768 Aug 18  2025 \033[01;32mgresource\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      43920 Sep 20  2022 \033[01;32mgroups\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      26944 Aug 18  2025 \033[01;32mgsettings\033[0m\r\n"
+    "-rwxr-xr-x 2 root root       2346 Apr 10  2022 \033[01;32mgunzip\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       6447 Apr 10  2022 \033[01;32mgzexe\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      98136 Apr 10  2022 \033[01;32mgzip\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      29227 Aug 29  2025 \033[01;32mh2ph\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      60934 Aug 29  2025 \033[01;32mh2xs\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      13081 Dec 18  2022 \033[01;32mh5c++\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      12848 Dec 18  2022 \033[01;32mh5cc\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      12666 Dec 18  2022 \033[01;32mh5fc\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      51600 Nov 21  2024 \033[01;32mhardlink\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48080 Sep 20  2022 \033[01;32mhead\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       2514 Feb 16  2025 \033[01;32mhelpztags\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      19080 Nov 19  2022 \033[01;32mhmac256\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      39760 Sep 20  2022 \033[01;32mhostid\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      22680 Dec 19  2022 \033[01;32mhostname\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      31104 Jun 26  2025 \033[01;32mhostnamectl\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          7 Nov 21  2024 \033[01;36mi386\033[0m -> setarch\r\n"
+    "-rwxr-xr-x 1 root root      64648 Aug 25  2025 \033[01;32miconv\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      54496 Jun 22  2025 \033[01;32micuexportdata\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14912 Jun 22  2025 \033[01;32micuinfo\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      48144 Sep 20  2022 \033[01;32mid\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       4183 Jan 14  2023 \033[01;32mifnames\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      63808 May  7  2023 \033[01;32minfocmp\033[0m\r\n"
+    "lrwxrwxrwx 1 root root          3 May  7  2023 \033[01;36minfotocap\033[0m -> tic\r\n"
+    "-rwxr-xr-x 1 root root     560520 May 19  2023 \033[01;32minspect\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     159544 Sep 20  2022 \033[01;32minstall\033[0m\r\n"
+    "-rwxr-xr-x 1 root root       4373 Aug 29  2025 \033[01;32minstmodsh\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35136 Nov 21  2024 \033[01;32mionice\033[0m\r\n"
+    "-rwxr-xr-x 1 root root     691016 May 22  2023 \033[01;32mip\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35200 Nov 21  2024 \033[01;32mipcmk\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      35136 Nov 21  2024 \033[01;32mipcrm\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      76096 Nov 21  2024 \033[01;32mipcs\033[0m\r\n"
+    "-rwxr-xr-x 1 root root      14664 Jul 28  2023 \033[01;32mischroot\033[0m\r\n";
+
+static const char log_diff[] =
+    "\033[1mdiff --git a/capture.c b/capture.c\033[m\r\n"
+    "\033[1mnew file mode 100644\033[m\r\n"
+    "\033[1mindex 0000000..83cbd80\033[m\r\n"
+    "\033[1m--- /dev/null\033[m\r\n"
+    "\033[1m+++ b/capture.c\033[m\r\n"
+    "\033[36m@@ -0,0 +1,169 @@\033[m\r\n"
+    "\033[32m+\033[m\033[32m/**\033[m\r\n"
+    "\033[32m+\033[m\033[32m * Framebuffer capture over USB serial, see capture.h for the stream form"
+    "at\033[m\r\n"
+    "\033[32m+\033[m\033[32m */\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include \"pico/stdlib.h\"\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include \"vga.h\"\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include \"capture.h\"\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m#define LITERAL_MAX 64\033[m\r\n"
+    "\033[32m+\033[m\033[32m#define REPEAT_MAX 65\033[m\r\n"
+    "\033[32m+\033[m\033[32m#define COPY_MAX 128\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic uint8_t chunk[CAPTURE_CHUNK];\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic uint32_t chunk_len;\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic uint32_t body_bytes;\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic uint32_t transfer_us;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void flush_chunk()\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t start = time_us_32();\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (uint32_t i = 0; i < chunk_len; i++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        putchar_raw(chunk[i]);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    transfer_us += time_us_32() - start;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    chunk_len = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_byte(uint8_t b)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (chunk_len == CAPTURE_CHUNK)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        flush_chunk();\033[m\r\n"
+    "\033[32m+\033[m\033[32m    chunk[chunk_len++] = b;\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_u16(uint16_t v)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte(v);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte(v >> 8);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_u32(uint32_t v)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u16(v);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u16(v >> 16);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_literals(const uint32_t *words, int count)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    while (count > 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int n = count > LITERAL_MAX \? LITERAL_MAX : count;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        put_byte(n - 1);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        for (int i = 0; i < n; i++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            put_u32(words[i]);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        body_bytes += 1 + 4 * n;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        words += n;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        count -= n;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_repeat(uint32_t word, int count)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    while (count > 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        // A repeat token covers at least two words, a lone one is a lite"
+    "ral\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (count == 1)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            put_literals(&word, 1);\033[m\r\n"
+    "\033[32m+\033[m\033[32m            return;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int n = count > REPEAT_MAX \? REPEAT_MAX : count;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        put_byte(0x40 + n - 2);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        put_u32(word);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        body_bytes += 5;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        count -= n;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void put_copy(int count)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    // A line is never longer than COPY_MAX words\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte(0x80 + count - 1);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    body_bytes++;\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m// Compress one line. above is NULL for the first line.\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void encode_line(const uint32_t *line, const uint32_t *above)\033["
+    "m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int literal_start = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int i = 0;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    while (i < VGA_LINE_WORDS)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int copy = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (above)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            while (i + copy < VGA_LINE_WORDS && line[i + copy] == above[i"
+    " + copy])\033[m\r\n"
+    "\033[32m+\033[m\033[32m                copy++;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int repeat = 1;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        while (i + repeat < VGA_LINE_WORDS && line[i + repeat] == line[i]"
+    ")\033[m\r\n"
+    "\033[32m+\033[m\033[32m            repeat++;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m        // A copy costs one byte for any length, so it wins ties\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (copy > 0 && copy >= repeat)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            put_literals(&line[literal_start], i - literal_start);\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m            put_copy(copy);\033[m\r\n"
+    "\033[32m+\033[m\033[32m            i += copy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m            literal_start = i;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m        else if (repeat >= 2)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            put_literals(&line[literal_start], i - literal_start);\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m            put_repeat(line[i], repeat);\033[m\r\n"
+    "\033[32m+\033[m\033[32m            i += repeat;\033[m\r\n"
+    "\033[32m+\033[m\033[32m            literal_start = i;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m        else\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            i++;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_literals(&line[literal_start], i - literal_start);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid vga_capture(void)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    chunk_len = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    body_bytes = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    transfer_us = 0;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    vga_wait_vblank();\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t start = time_us_32();\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('V');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('G');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('A');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('C');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte(CAPTURE_VERSION);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte(CAPTURE_FORMAT_PACKED6);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u16(VGA_WIDTH);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u16(VGA_HEIGHT);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u16(VGA_LINE_WORDS);\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t sum = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int y = 0; y < VGA_HEIGHT; y++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        const uint32_t *line = &vga_data_array[y * VGA_LINE_WORDS];\033[m"
+    "\r\n"
+    "\033[32m+\033[m\033[32m        encode_line(line, y > 0 \? line - VGA_LINE_WORDS : NULL);\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m        for (int i = 0; i < VGA_LINE_WORDS; i++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            sum += line[i];\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    flush_chunk();\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    // Everything that is not USB time went into compressing\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t encode_us = time_us_32() - start - transfer_us;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('V');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('E');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('N');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_byte('D');\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u32(TXCOUNT);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u32(sum);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u32(body_bytes);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u32(encode_us);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_u32(transfer_us);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    flush_chunk();\033[m\r\n"
+    "\033[32m+\033[m\033[32m    stdio_flush();\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[1mdiff --git a/gfx.c b/gfx.c\033[m\r\n"
+    "\033[1mnew file mode 100644\033[m\r\n"
+    "\033[1mindex 0000000..ad9a548\033[m\r\n"
+    "\033[1m--- /dev/null\033[m\r\n"
+    "\033[1m+++ b/gfx.c\033[m\r\n"
+    "\033[36m@@ -0,0 +1,244 @@\033[m\r\n"
+    "\033[32m+\033[m\033[32m/**\033[m\r\n"
+    "\033[32m+\033[m\033[32m * Drawing primitives for the VGA screen, see gfx.h\033[m\r\n"
+    "\033[32m+\033[m\033[32m */\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include <stdlib.h>\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include \"gfx.h\"\033[m\r\n"
+    "\033[32m+\033[m\033[32m#include \"font.h\"\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic inline void put_pixel(uint32_t *row, int x, uint32_t color)\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t *word = &row[x / 5];\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int shift = VGA_PIXEL_SHIFT(x % 5);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    *word = (*word & ~(VGA_PIXEL_MASK << shift)) | (color << shift);\033["
+    "m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic inline void put_masked(uint32_t *word, uint32_t value, uint32_t ma"
+    "sk)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    *word = (*word & ~mask) | (value & mask);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m// Fill pixels x0..x1 (inclusive, already clipped) of a row\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void fill_span(uint32_t *row, int x0, int x1, uint32_t color)\033["
+    "m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t solid = VGA_SOLID(color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int w0 = x0 / 5;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int w1 = x1 / 5;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (w0 == w1)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        put_masked(&row[w0], solid, VGA_SPAN_MASK(x0 % 5, x1 % 5));\033[m"
+    "\r\n"
+    "\033[32m+\033[m\033[32m        return;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_masked(&row[w0], solid, VGA_SPAN_MASK(x0 % 5, 4));\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int i = w0 + 1; i < w1; i++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        row[i] = solid;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    put_masked(&row[w1], solid, VGA_SPAN_MASK(0, x1 % 5));\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m// The 5 pixels starting at pixel p (-4 or more) of a row of the given le"
+    "ngth\033[m\r\n"
+    "\033[32m+\033[m\033[32m// in words. Pixels outside the row read as 0.\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic inline uint32_t fetch5(const uint32_t *row, int words, int p)\033["
+    "m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int k = (p + 5) / 5 - 1;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int off = (p + 5) % 5;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t hi = (k >= 0 && k < words) \? row[k] : 0;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (off == 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        return hi;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t lo = (k + 1 < words) \? row[k + 1] : 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    return ((hi << (off * VGA_BITS_PER_PIXEL)) | (lo >> (30 - off * VGA_B"
+    "ITS_PER_PIXEL))) & VGA_WORD_MASK;\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m// Copy w pixels from pixel sx of src to pixel dx of dst (already clipped"
+    ")\033[m\r\n"
+    "\033[32m+\033[m\033[32mstatic void copy_span(uint32_t *dst, int dx, const uint32_t *src, int src"
+    "_words, int sx, int w)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int x1 = dx + w - 1;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int w0 = dx / 5;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int w1 = x1 / 5;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int delta = sx - dx;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int i = w0; i <= w1; i++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int first = (i == w0) \? dx % 5 : 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int last = (i == w1) \? x1 % 5 : 4;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        uint32_t value = fetch5(src, src_words, i * 5 + delta);\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (first == 0 && last == 4)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            dst[i] = value;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        else\033[m\r\n"
+    "\033[32m+\033[m\033[32m            put_masked(&dst[i], value, VGA_SPAN_MASK(first, last));\033[m"
+    "\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawHLine(int x, int y, int w, char color)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    fillRect(x, y, w, 1, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawVLine(int x, int y, int h, char color)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    fillRect(x, y, 1, h, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid fillRect(int x, int y, int w, int h, char color)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (x < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w += x;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        x = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (y < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h += y;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        y = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (x + w > VGA_WIDTH)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w = VGA_WIDTH - x;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (y + h > VGA_HEIGHT)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h = VGA_HEIGHT - y;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (w <= 0 || h <= 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        return;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int row = y; row < y + h; row++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        fill_span(vga_row(row), x, x + w - 1, color & VGA_PIXEL_MASK);\033"
+    "[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawRect(int x, int y, int w, int h, char color)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (w <= 0 || h <= 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        return;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    drawHLine(x, y, w, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    drawHLine(x, y + h - 1, w, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    drawVLine(x, y, h, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    drawVLine(x + w - 1, y, h, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawLine(int x0, int y0, int x1, int y1, char color)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (y0 == y1)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (x1 < x0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            drawHLine(x1, y0, x0 - x1 + 1, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        else\033[m\r\n"
+    "\033[32m+\033[m\033[32m            drawHLine(x0, y0, x1 - x0 + 1, color);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        return;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    // Bresenham, clipping each pixel\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int dx = abs(x1 - x0);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int dy = -abs(y1 - y0);\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int sx = x0 < x1 \? 1 : -1;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int sy = y0 < y1 \? 1 : -1;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    int err = dx + dy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t c = color & VGA_PIXEL_MASK;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    while (true)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (x0 >= 0 && x0 < VGA_WIDTH && y0 >= 0 && y0 < VGA_HEIGHT)\033["
+    "m\r\n"
+    "\033[32m+\033[m\033[32m            put_pixel(vga_row(y0), x0, c);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (x0 == x1 && y0 == y1)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            break;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int e2 = 2 * err;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (e2 >= dy)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            err += dy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m            x0 += sx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (e2 <= dx)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            err += dx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m            y0 += sy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawChar(int x, int y, unsigned char c, char color, char bg)\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (c < FONT_FIRST || c >= FONT_FIRST + FONT_GLYPHS)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        c = '\?';\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    const uint8_t *glyph = font_5x7[c - FONT_FIRST];\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t fg = color & VGA_PIXEL_MASK;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    uint32_t back = bg & VGA_PIXEL_MASK;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    bool opaque = fg != back;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int row = 0; row < FONT_HEIGHT; row++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        int py = y + row;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        if (py < 0 || py >= VGA_HEIGHT)\033[m\r\n"
+    "\033[32m+\033[m\033[32m            continue;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m        uint32_t *line = vga_row(py);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        uint8_t bits = row < FONT_ROWS \? glyph[row] : 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        for (int col = 0; col < FONT_WIDTH; col++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        {\033[m\r\n"
+    "\033[32m+\033[m\033[32m            int px = x + col;\033[m\r\n"
+    "\033[32m+\033[m\033[32m            if (px < 0 || px >= VGA_WIDTH)\033[m\r\n"
+    "\033[32m+\033[m\033[32m                continue;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m            // Bit 4 is the leftmost pixel, column 5 is spacing\033[m\r\n"
+    "\033[32m+\033[m\033[32m            if (bits & (0x10 >> col))\033[m\r\n"
+    "\033[32m+\033[m\033[32m                put_pixel(line, px, fg);\033[m\r\n"
+    "\033[32m+\033[m\033[32m            else if (opaque)\033[m\r\n"
+    "\033[32m+\033[m\033[32m                put_pixel(line, px, back);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid drawString(int x, int y, const char *s, char color, char bg)\033[m\r"
+    "\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (; *s; s++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        drawChar(x, y, *s, color, bg);\033[m\r\n"
+    "\033[32m+\033[m\033[32m        x += FONT_WIDTH;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32mvoid blitSurface(const vga_surface_t *src, int sx, int sy, int w, int h, "
+    "int dx, int dy)\033[m\r\n"
+    "\033[32m+\033[m\033[32m{\033[m\r\n"
+    "\033[32m+\033[m\033[32m    // Clip against the source\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (sx < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w += sx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        dx -= sx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        sx = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (sy < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h += sy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        dy -= sy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        sy = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (sx + w > src->width)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w = src->width - sx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (sy + h > src->height)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h = src->height - sy;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    // and against the screen\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (dx < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w += dx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        sx -= dx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        dx = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (dy < 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m    {\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h += dy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        sy -= dy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m        dy = 0;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    }\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (dx + w > VGA_WIDTH)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        w = VGA_WIDTH - dx;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (dy + h > VGA_HEIGHT)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        h = VGA_HEIGHT - dy;\033[m\r\n"
+    "\033[32m+\033[m\033[32m    if (w <= 0 || h <= 0)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        return;\033[m\r\n"
+    "\033[32m+\033[m\r\n"
+    "\033[32m+\033[m\033[32m    for (int row = 0; row < h; row++)\033[m\r\n"
+    "\033[32m+\033[m\033[32m        copy_span(vga_row(dy + row), dx, surfaceRow(src, sy + row), src->"
+    "stride, sx, w);\033[m\r\n"
+    "\033[32m+\033[m\033[32m}\033[m\r\n"
+    "\033[1mdiff --git a/vga.c b/vga.c\033[m\r\n"
+    "\033[1mindex 59e19ec..f8daecb 100644\033[m\r\n"
+    "\033[1m--- a/vga.c\033[m\r\n"
+    "\033[1m+++ b/vga.c\033[m\r\n"
+    "\033[36m@@ -1,159 +1,208 @@\033[m\r\n"
+    "\033[31m-/**\033[m\r\r\n"
+    "\033[31m- * Hunter Adams (vha3@cornell.edu)\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- * Modified by:\033[m\r\r\n"
+    "\033[31m- * Sander Groen (sandergroen@gmail.com)\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- * VGA driver using PIO assembler\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- * HARDWARE CONNECTIONS\033[m\r\r\n"
+    "\033[31m- *  - GPIO 0 ---> 390 ohm resistor ---> VGA Red\033[m\r\r\n"
+    "\033[31m- *  - GPIO 1 ---> 1K ohm resistor ---> VGA Red\033[m\r\r\n"
+    "\033[31m- *  - GPIO 2 ---> 390 ohm resistor ---> VGA Green\033[m\r\r\n"
+    "\033[31m- *  - GPIO 3 ---> 1K ohm resistor ---> VGA Green\033[m\r\r\n"
+    "\033[31m- *  - GPIO 4 ---> 390 ohm resistor ---> VGA Blue\033[m\r\r\n"
+    "\033[31m- *  - GPIO 5 ---> 1K ohm resistor ---> VGA Blue\033[m\r\r\n"
+    "\033[31m- *  - GPIO 6 ---> VGA Hsync\033[m\r\r\n"
+    "\033[31m- *  - GPIO 7 ---> VGA Vsync\033[m\r\r\n"
+    "\033[31m- *  - RP2040 GND ---> VGA GND\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- * RESOURCES USED\033[m\r\r\n"
+    "\033[31m- *  - PIO state machines 0, 1, and 2 on PIO instance 0\033[m\r\r\n"
+    "\033[31m- *  - DMA channels 0 and 1\033[m\r\r\n"
+    "\033[31m- *  - 614.4 kBytes of RAM (for pixel color data)\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- * HOW TO USE THIS CODE\033[m\r\r\n"
+    "\033[31m- *  This code uses one DMA channel to send pixel data to a PIO state machine\033[m\r\r\n"
+    "\033[31m- *  that is driving the VGA display, and a second DMA channel to reconfigure\033[m\r\r\n"
+    "\033[31m- *  and restart the first. As such, changing any value in the pixel color\033[m\r\r\n"
+    "\033[31m- *  array will be automatically reflected on the VGA display screen.\033[m\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- *  To help with this, I have included a function called drawPixel which takes,\033[m\r"
+    "\r\n"
+    "\033[31m- *  as arguments, a VGA x-coordinate (int), a VGA y-coordinate (int), and a\033[m\r\r\n"
+    "\033[31m- *  pixel color (char). Only 6 bits are used for RGB, so there are only 64 possible\033"
+    "[m\r\r\n"
+    "\033[31m- *  colors. If you keep all of the code above line 124, this interface will work.\033[m"
+    "\r\r\n"
+    "\033[31m- *\033[m\r\r\n"
+    "\033[31m- */\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-#include <stdio.h>\033[m\r\r\n"
+    "\033[31m-#include \"pico/stdlib.h\"\033[m\r\r\n"
+    "\033[31m-#include \"hardware/pio.h\"\033[m\r\r\n"
+    "\033[31m-#include \"hardware/dma.h\"\033[m\r\r\n"
+    "\033[31m-#include \"hsync.pio.h\"\033[m\r\r\n"
+    "\033[31m-#include \"vsync.pio.h\"\033[m\r\r\n"
+    "\033[31m-#include \"rgb.pio.h\"\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-#define H_ACTIVE 655   // 640+16-1\033[m\r\r\n"
+    "\033[31m-#define V_ACTIVE 479   // 480-1\033[m\r\r\n"
+    "\033[31m-#define RGB_ACTIVE 127 // 640/5-1\033[m\r\r\n"
+    "\033[31m-#define RED_PIN 0\033[m\r\r\n"
+    "\033[31m-#define HSYNC 6\033[m\r\r\n"
+    "\033[31m-#define VSYNC 7\033[m\r\r\n"
+    "\033[31m-#define TXCOUNT 61440\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-uint32_t vga_data_array[TXCOUNT];\033[m\r\r\n"
+    "\033[31m-uint32_t *address_pointer = &vga_data_array[0];\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-void drawPixel(int x, int y, char color)\033[m\r\r\n"
+    "\033[31m-{\033[m\r\r\n"
+    "\033[31m-    if (x > 639)\033[m\r\r\n"
+    "\033[31m-        x = 639;\033[m\r\r\n"
+    "\033[31m-    if (x < 0)\033[m\r\r\n"
+    "\033[31m-        x = 0;\033[m\r\r\n"
+    "\033[31m-    if (y < 0)\033[m\r\r\n"
+    "\033[31m-        y = 0;\033[m\r\r\n"
+    "\033[31m-    if (y > 479)\033[m\r\r\n"
+    "\033[31m-        y = 479;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    int pixel = ((640 * y) + x);\033[m\r\r\n"
+    "\033[31m-    // Put 5 pixel values into a single 32-bit integer\033[m\r\r\n"
+    "\033[31m-    vga_data_array[pixel / 5] |= (color << (24 - ((pixel % 5) * 6)));\033[m\r\r\n"
+    "\033[31m-}\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-int main()\033[m\r\r\n"
+    "\033[31m-{\033[m\r\r\n"
+    "\033[31m-    stdio_init_all();\033[m\r\r\n"
+    "\033[31m-    PIO pio = pio0;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    uint hsync_offset = pio_add_program(pio, &hsync_program);\033[m\r\r\n"
+    "\033[31m-    uint vsync_offset = pio_add_program(pio, &vsync_program);\033[m\r\r\n"
+    "\033[31m-    uint rgb_offset = pio_add_program(pio, &rgb_program);\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    uint hsync_sm = 0;\033[m\r\r\n"
+    "\033[31m-    uint vsync_sm = 1;\033[m\r\r\n"
+    "\033[31m-    uint rgb_sm = 2;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    hsync_program_init(pio, hsync_sm, hsync_offset, HSYNC);\033[m\r\r\n"
+    "\033[31m-    vsync_program_init(pio, vsync_sm, vsync_offset, VSYNC);\033[m\r\r\n"
+    "\033[31m-    rgb_program_init(pio, rgb_sm, rgb_offset, RED_PIN);\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    int rgb_chan_0 = 0;\033[m\r\r\n"
+    "\033[31m-    int rgb_chan_1 = 1;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    dma_channel_config c0 = dma_channel_get_default_config(rgb_chan_0); // default conf"
+    "igs\033[m\r\r\n"
+    "\033[31m-    channel_config_set_transfer_data_size(&c0, DMA_SIZE_32);            // 8-bit txfers"
+    "\033[m\r\r\n"
+    "\033[31m-    channel_config_set_read_increment(&c0, true);                       // yes read inc"
+    "rementing\033[m\r\r\n"
+    "\033[31m-    channel_config_set_write_increment(&c0, false);                     // no write inc"
+    "rementing\033[m\r\r\n"
+    "\033[31m-    channel_config_set_dreq(&c0, DREQ_PIO0_TX2);                        // DREQ_PIO0_TX"
+    "2 pacing (FIFO)\033[m\r\r\n"
+    "\033[31m-    channel_config_set_chain_to(&c0, rgb_chan_1);                       // chain to oth"
+    "er channel\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    dma_channel_configure(\033[m\r\r\n"
+    "\033[31m-        rgb_chan_0,        // Channel to be configured\033[m\r\r\n"
+    "\033[31m-        &c0,               // The configuration we just created\033[m\r\r\n"
+    "\033[31m-        &pio->txf[rgb_sm], // write address (RGB PIO TX FIFO)\033[m\r\r\n"
+    "\033[31m-        &vga_data_array,   // The initial read address (pixel color array)\033[m\r\r\n"
+    "\033[31m-        TXCOUNT,           // Number of transfers; in this case each is 4 bytes.\033[m\r"
+    "\r\n"
+    "\033[31m-        false              // Don't start immediately.\033[m\r\r\n"
+    "\033[31m-    );\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    // Channel One (reconfigures the first channel)\033[m\r\r\n"
+    "\033[31m-    dma_channel_config c1 = dma_channel_get_default_config(rgb_chan_1); // default conf"
+    "igs\033[m\r\r\n"
+    "\033[31m-    channel_config_set_transfer_data_size(&c1, DMA_SIZE_32);            // 32-bit txfer"
+    "s\033[m\r\r\n"
+    "\033[31m-    channel_config_set_read_increment(&c1, false);                      // no read incr"
+    "ementing\033[m\r\r\n"
+    "\033[31m-    channel_config_set_write_increment(&c1, false);                     // no write inc"
+    "rementing\033[m\r\r\n"
+    "\033[31m-    channel_config_set_chain_to(&c1, rgb_chan_0);                       // chain to oth"
+    "er channel\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    dma_channel_configure(\033[m\r\r\n"
+    "\033[31m-        rgb_chan_1,                        // Channel to be configured\033[m\r\r\n"
+    "\033[31m-        &c1,                               // The configuration we just created\033[m\r"
+    "\r\n"
+    "\033[31m-        &dma_hw->ch[rgb_chan_0].read_addr, // Write address (channel 0 read address)\033"
+    "[m\r\r\n"
+    "\033[31m-        &address_pointer,                  // Read address (POINTER TO AN ADDRESS)\033["
+    "m\r\r\n"
+    "\033[31m-        1,                                 // Number of transfers, in this case each is"
+    " 4 byte\033[m\r\r\n"
+    "\033[31m-        false                              // Don't start immediately.\033[m\r\r\n"
+    "\033[31m-    );\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    pio_sm_put_blocking(pio, hsync_sm, H_ACTIVE);\033[m\r\r\n"
+    "\033[31m-    pio_sm_put_blocking(pio, vsync_sm, V_ACTIVE);\033[m\r\r\n"
+    "\033[31m-    pio_sm_put_blocking(pio, rgb_sm, RGB_ACTIVE);\033[m\r\r\n"
+    "\033[31m-    pio_enable_sm_mask_in_sync(pio, ((1u << hsync_sm) | (1u << vsync_sm) | (1u << rgb_s"
+    "m)));\033[m\r\r\n"
+    "\033[31m-    dma_start_channel_mask((1u << rgb_chan_0));\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-    while (true)\033[m\r\r\n"
+    "\033[31m-    {\033[m\r\r\n"
+    "\033[31m-        int index = 0;\033[m\r\r\n"
+    "\033[31m-        int xcounter = 0;\033[m\r\r\n"
+    "\033[31m-        int ycounter = 0;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-        for (int y = 0; y < 480; y++)\033[m\r\r\n"
+    "\033[31m-        {\033[m\r\r\n"
+    "\033[31m-            if (ycounter == 8)\033[m\r\r\n"
+    "\033[31m-            {\033[m\r\r\n"
+    "\033[31m-                ycounter = 0;\033[m\r\r\n"
+    "\033[31m-                index = (index + 1) % 64;\033[m\r\r\n"
+    "\033[31m-            }\033[m\r\r\n"
+    "\033[31m-            ycounter += 1;\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-            for (int x = 0; x < 640; x++)\033[m\r\r\n"
+    "\033[31m-            {\033[m\r\r\n"
+    "\033[31m-                if (xcounter == 10)\033[m\r\r\n"
+    "\033[31m-                {\033[m\r\r\n"
+    "\033[31m-                    xcounter = 0;\033[m\r\r\n"
+    "\033[31m-                    index = (index + 1) % 64;\033[m\r\r\n"
+    "\033[31m-                }\033[m\r\r\n"
+    "\033[31m-\033[m\r\r\n"
+    "\033[31m-                xcounter += 1;\033[m\r\r\n"
+    "\033[31m-                drawPixel(x, y, index);\033[m\r\r\n"
+    "\033[31m-            }\033[m\r\r\n"
+    "\033[31m-        }\033[m\r\r\n"
+    "\033[31m-    }\033[m\r\r\n"
+    "\033[31m-}\033[m\r\r\n"
+    "\033[32m+\033[m\033[32m/**\033[m\r\n"
+    "\033[32m+\033[m\033[32m * Hunter Adams (vha3@cornell.edu)\033[m\r\n"
+    "\033[32m+\033[m\033[32m *\033[m\r\n"
+    "\033[32m+\033[m\033[32m * Modified by:\033[m\r\n"
+    "\033[32m+\033[m\033[32m * Sander";
+
+static const char log_dashboard[] =
+    "\033[\?25l\033[2J\033[H\033[7m sensor node 7  uptime                                            "
+    "                                        \033[0m\033[13;60r\033[3;1H\033[1mch0\033[22m  28.9 \033"
+    "[48;5;136m                                       \033[0m\033[K\033[4;1H\033[1mch1\033[22m  10.0 "
+    "\033[48;5;76m             \033[0m\033[K\033[5;1H\033[1mch2\033[22m  21.5 \033[48;5;106m         "
+    "                    \033[0m\033[K\033[6;1H\033[1mch3\033[22m  23.7 \033[48;5;136m               "
+    "                 \033[0m\033[K\033[7;1H\033[1mch4\033[22m  33.7 \033[48;5;166m                  "
+    "                           \033[0m\033[K\033[8;1H\033[1mch5\033[22m  22.6 \033[48;5;136m        "
+    "                      \033[0m\033[K\033[9;1H\033[1mch6\033[22m  33.7 \033[48;5;166m             "
+    "                                \033[0m\033[K\033[10;1H\033[1mch7\033[22m  24.4 \033[48;5;136m  "
+    "                               \033[0m\033[K\033[1;40H\033[7m     0 s\033[0m\033[12;1H\033[38;2;"
+    "120;120;255m------------------------------------------------------------------------------------"
+    "----------------------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 000000 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 000001 buffer high water 1169\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 000002 link quality 50%\033[3;1H\033[1mch0\033[22m  20.7 \033[48;5;106m     "
+    "                       \033[0m\033[K\033[4;1H\033[1mch1\033[22m   9.2 \033[48;5;76m            \033"
+    "[0m\033[K\033[5;1H\033[1mch2\033[22m  10.7 \033[48;5;76m              \033[0m\033[K\033[6;1H\033"
+    "[1mch3\033[22m   5.9 \033[48;5;46m        \033[0m\033[K\033[7;1H\033[1mch4\033[22m   6.3 \033[48"
+    ";5;46m        \033[0m\033[K\033[8;1H\033[1mch5\033[22m  16.3 \033[48;5;106m                     "
+    " \033[0m\033[K\033[9;1H\033[1mch6\033[22m  23.7 \033[48;5;136m                                \033"
+    "[0m\033[K\033[10;1H\033[1mch7\033[22m  35.9 \033[48;5;166m                                      "
+    "          \033[0m\033[K\033[1;40H\033[7m     1 s\033[0m\033[12;1H\033[38;2;120;120;255m---------"
+    "------------------------------------------------------------------------------------------------"
+    "-\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 001000 link quality 43%\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 001001 calibration ok\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 001002 sample queue drained\033[3;1H\033[1mch0\033[22m  21.1 \033[48;5;106m "
+    "                           \033[0m\033[K\033[4;1H\033[1mch1\033[22m  30.3 \033[48;5;166m        "
+    "                                 \033[0m\033[K\033[5;1H\033[1mch2\033[22m  22.6 \033[48;5;136m  "
+    "                            \033[0m\033[K\033[6;1H\033[1mch3\033[22m  10.7 \033[48;5;76m        "
+    "      \033[0m\033[K\033[7;1H\033[1mch4\033[22m  16.3 \033[48;5;106m                      \033[0m"
+    "\033[K\033[8;1H\033[1mch5\033[22m  27.8 \033[48;5;136m                                     \033["
+    "0m\033[K\033[9;1H\033[1mch6\033[22m  10.7 \033[48;5;76m              \033[0m\033[K\033[10;1H\033"
+    "[1mch7\033[22m   6.7 \033[48;5;46m         \033[0m\033[K\033[1;40H\033[7m     2 s\033[0m\033[12;"
+    "1H\033[38;2;120;120;255m------------------------------------------------------------------------"
+    "----------------------------------\033[0m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 002000 sample queue drained\033[3;1H\033[1mch0\033[22m  36.3 \033[48;5;166m "
+    "                                                \033[0m\033[K\033[4;1H\033[1mch1\033[22m  22.6 \033"
+    "[48;5;136m                              \033[0m\033[K\033[5;1H\033[1mch2\033[22m  18.5 \033[48;5"
+    ";106m                         \033[0m\033[K\033[6;1H\033[1mch3\033[22m  25.9 \033[48;5;136m     "
+    "                              \033[0m\033[K\033[7;1H\033[1mch4\033[22m  15.2 \033[48;5;106m     "
+    "               \033[0m\033[K\033[8;1H\033[1mch5\033[22m  11.8 \033[48;5;76m                \033["
+    "0m\033[K\033[9;1H\033[1mch6\033[22m  11.1 \033[48;5;76m               \033[0m\033[K\033[10;1H\033"
+    "[1mch7\033[22m   2.6 \033[48;5;46m   \033[0m\033[K\033[1;40H\033[7m     3 s\033[0m\033[12;1H\033"
+    "[38;2;120;120;255m------------------------------------------------------------------------------"
+    "----------------------------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 003000 watchdog fed\033[60;1H\r\n"
+    "\033[31mERR \033[0m 003001 link quality 81%\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 003002 retry 9 on bus 2\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 003003 retry 4 on bus 2\033[3;1H\033[1mch0\033[22m   4.4 \033[48;5;46m      "
+    "\033[0m\033[K\033[4;1H\033[1mch1\033[22m  34.8 \033[48;5;166m                                   "
+    "            \033[0m\033[K\033[5;1H\033[1mch2\033[22m  30.7 \033[48;5;166m                       "
+    "                  \033[0m\033[K\033[6;1H\033[1mch3\033[22m  20.0 \033[48;5;106m                 "
+    "          \033[0m\033[K\033[7;1H\033[1mch4\033[22m   3.0 \033[48;5;46m    \033[0m\033[K\033[8;1H"
+    "\033[1mch5\033[22m  18.1 \033[48;5;106m                        \033[0m\033[K\033[9;1H\033[1mch6\033"
+    "[22m  17.8 \033[48;5;106m                        \033[0m\033[K\033[10;1H\033[1mch7\033[22m   3.3"
+    " \033[48;5;46m    \033[0m\033[K\033[1;40H\033[7m     4 s\033[0m\033[12;1H\033[38;2;120;120;255m-"
+    "------------------------------------------------------------------------------------------------"
+    "---------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 004000 calibration ok\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 004001 link quality 99%\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 004002 link quality 71%\033[3;1H\033[1mch0\033[22m  10.0 \033[48;5;76m      "
+    "       \033[0m\033[K\033[4;1H\033[1mch1\033[22m  26.3 \033[48;5;136m                            "
+    "       \033[0m\033[K\033[5;1H\033[1mch2\033[22m  15.5 \033[48;5;106m                     \033[0m"
+    "\033[K\033[6;1H\033[1mch3\033[22m   6.3 \033[48;5;46m        \033[0m\033[K\033[7;1H\033[1mch4\033"
+    "[22m  35.9 \033[48;5;166m                                                \033[0m\033[K\033[8;1H\033"
+    "[1mch5\033[22m   8.5 \033[48;5;76m           \033[0m\033[K\033[9;1H\033[1mch6\033[22m  12.9 \033"
+    "[48;5;76m                 \033[0m\033[K\033[10;1H\033[1mch7\033[22m  20.7 \033[48;5;106m        "
+    "                    \033[0m\033[K\033[1;40H\033[7m     5 s\033[0m\033[12;1H\033[38;2;120;120;255"
+    "m-----------------------------------------------------------------------------------------------"
+    "-----------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 005000 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 005001 buffer high water 3062\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 005002 buffer high water 877\033[3;1H\033[1mch0\033[22m  11.8 \033[48;5;76m "
+    "               \033[0m\033[K\033[4;1H\033[1mch1\033[22m  26.6 \033[48;5;136m                    "
+    "                \033[0m\033[K\033[5;1H\033[1mch2\033[22m  28.9 \033[48;5;136m                   "
+    "                    \033[0m\033[K\033[6;1H\033[1mch3\033[22m  22.2 \033[48;5;136m               "
+    "               \033[0m\033[K\033[7;1H\033[1mch4\033[22m  31.4 \033[48;5;166m                    "
+    "                      \033[0m\033[K\033[8;1H\033[1mch5\033[22m  15.5 \033[48;5;106m             "
+    "        \033[0m\033[K\033[9;1H\033[1mch6\033[22m  28.1 \033[48;5;136m                           "
+    "           \033[0m\033[K\033[10;1H\033[1mch7\033[22m   7.4 \033[48;5;76m          \033[0m\033[K\033"
+    "[1;40H\033[7m     6 s\033[0m\033[12;1H\033[38;2;120;120;255m------------------------------------"
+    "----------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[31mERR \033[0m 006000 watchdog fed\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 006001 buffer high water 3185\033[3;1H\033[1mch0\033[22m  20.4 \033[48;5;106"
+    "m                           \033[0m\033[K\033[4;1H\033[1mch1\033[22m  25.2 \033[48;5;136m       "
+    "                           \033[0m\033[K\033[5;1H\033[1mch2\033[22m  21.8 \033[48;5;106m        "
+    "                     \033[0m\033[K\033[6;1H\033[1mch3\033[22m  22.6 \033[48;5;136m              "
+    "                \033[0m\033[K\033[7;1H\033[1mch4\033[22m   6.7 \033[48;5;46m         \033[0m\033"
+    "[K\033[8;1H\033[1mch5\033[22m  31.1 \033[48;5;166m                                          \033"
+    "[0m\033[K\033[9;1H\033[1mch6\033[22m  32.2 \033[48;5;166m                                       "
+    "    \033[0m\033[K\033[10;1H\033[1mch7\033[22m  30.0 \033[48;5;166m                              "
+    "          \033[0m\033[K\033[1;40H\033[7m     7 s\033[0m\033[12;1H\033[38;2;120;120;255m---------"
+    "------------------------------------------------------------------------------------------------"
+    "-\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 007000 link quality 78%\033[60;1H\r\n"
+    "\033[31mERR \033[0m 007001 sample queue drained\033[60;1H\r\n"
+    "\033[31mERR \033[0m 007002 sample queue drained\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 007003 sample queue drained\033[3;1H\033[1mch0\033[22m   1.5 \033[48;5;46m  "
+    "\033[0m\033[K\033[4;1H\033[1mch1\033[22m  24.4 \033[48;5;136m                                 \033"
+    "[0m\033[K\033[5;1H\033[1mch2\033[22m  18.5 \033[48;5;106m                         \033[0m\033[K\033"
+    "[6;1H\033[1mch3\033[22m  25.9 \033[48;5;136m                                   \033[0m\033[K\033"
+    "[7;1H\033[1mch4\033[22m  36.3 \033[48;5;166m                                                 \033"
+    "[0m\033[K\033[8;1H\033[1mch5\033[22m  34.8 \033[48;5;166m                                       "
+    "        \033[0m\033[K\033[9;1H\033[1mch6\033[22m  30.7 \033[48;5;166m                           "
+    "              \033[0m\033[K\033[10;1H\033[1mch7\033[22m   1.5 \033[48;5;46m  \033[0m\033[K\033[1"
+    ";40H\033[7m     8 s\033[0m\033[12;1H\033[38;2;120;120;255m--------------------------------------"
+    "--------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 008000 calibration ok\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 008001 watchdog fed\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 008002 calibration ok\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 008003 sample queue drained\033[3;1H\033[1mch0\033[22m  18.9 \033[48;5;106m "
+    "                        \033[0m\033[K\033[4;1H\033[1mch1\033[22m  11.8 \033[48;5;76m            "
+    "    \033[0m\033[K\033[5;1H\033[1mch2\033[22m  13.7 \033[48;5;76m                  \033[0m\033[K\033"
+    "[6;1H\033[1mch3\033[22m   8.9 \033[48;5;76m            \033[0m\033[K\033[7;1H\033[1mch4\033[22m "
+    "  6.3 \033[48;5;46m        \033[0m\033[K\033[8;1H\033[1mch5\033[22m  35.5 \033[48;5;166m        "
+    "                                        \033[0m\033[K\033[9;1H\033[1mch6\033[22m  25.5 \033[48;5"
+    ";136m                                  \033[0m\033[K\033[10;1H\033[1mch7\033[22m  17.8 \033[48;5"
+    ";106m                        \033[0m\033[K\033[1;40H\033[7m     9 s\033[0m\033[12;1H\033[38;2;12"
+    "0;120;255m--------------------------------------------------------------------------------------"
+    "--------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 009000 calibration ok\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 009001 sample queue drained\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 009002 calibration ok\033[3;1H\033[1mch0\033[22m  30.0 \033[48;5;166m       "
+    "                                 \033[0m\033[K\033[4;1H\033[1mch1\033[22m  14.1 \033[48;5;76m   "
+    "                \033[0m\033[K\033[5;1H\033[1mch2\033[22m  21.5 \033[48;5;106m                   "
+    "          \033[0m\033[K\033[6;1H\033[1mch3\033[22m  16.6 \033[48;5;106m                      \033"
+    "[0m\033[K\033[7;1H\033[1mch4\033[22m  32.6 \033[48;5;166m                                       "
+    "     \033[0m\033[K\033[8;1H\033[1mch5\033[22m  35.1 \033[48;5;166m                              "
+    "                 \033[0m\033[K\033[9;1H\033[1mch6\033[22m  11.5 \033[48;5;76m               \033"
+    "[0m\033[K\033[10;1H\033[1mch7\033[22m  21.1 \033[48;5;106m                            \033[0m\033"
+    "[K\033[1;40H\033[7m    10 s\033[0m\033[12;1H\033[38;2;120;120;255m------------------------------"
+    "----------------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 010000 buffer high water 2553\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 010001 retry 9 on bus 2\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 010002 buffer high water 810\033[60;1H\r\n"
+    "\033[31mERR \033[0m 010003 link quality 60%\033[3;1H\033[1mch0\033[22m  27.4 \033[48;5;136m     "
+    "                                \033[0m\033[K\033[4;1H\033[1mch1\033[22m   3.7 \033[48;5;46m    "
+    " \033[0m\033[K\033[5;1H\033[1mch2\033[22m  13.3 \033[48;5;76m                  \033[0m\033[K\033"
+    "[6;1H\033[1mch3\033[22m  18.9 \033[48;5;106m                         \033[0m\033[K\033[7;1H\033["
+    "1mch4\033[22m  18.9 \033[48;5;106m                         \033[0m\033[K\033[8;1H\033[1mch5\033["
+    "22m   3.0 \033[48;5;46m    \033[0m\033[K\033[9;1H\033[1mch6\033[22m  30.0 \033[48;5;166m        "
+    "                                \033[0m\033[K\033[10;1H\033[1mch7\033[22m   4.4 \033[48;5;46m   "
+    "   \033[0m\033[K\033[1;40H\033[7m    11 s\033[0m\033[12;1H\033[38;2;120;120;255m----------------"
+    "------------------------------------------------------------------------------------------\033[0"
+    "m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 011000 retry 6 on bus 2\033[3;1H\033[1mch0\033[22m  20.0 \033[48;5;106m     "
+    "                      \033[0m\033[K\033[4;1H\033[1mch1\033[22m  14.4 \033[48;5;76m              "
+    "     \033[0m\033[K\033[5;1H\033[1mch2\033[22m  18.5 \033[48;5;106m                         \033["
+    "0m\033[K\033[6;1H\033[1mch3\033[22m  27.8 \033[48;5;136m                                     \033"
+    "[0m\033[K\033[7;1H\033[1mch4\033[22m   5.9 \033[48;5;46m        \033[0m\033[K\033[8;1H\033[1mch5"
+    "\033[22m  35.9 \033[48;5;166m                                                \033[0m\033[K\033[9"
+    ";1H\033[1mch6\033[22m   9.2 \033[48;5;76m            \033[0m\033[K\033[10;1H\033[1mch7\033[22m  "
+    "31.1 \033[48;5;166m                                          \033[0m\033[K\033[1;40H\033[7m    1"
+    "2 s\033[0m\033[12;1H\033[38;2;120;120;255m------------------------------------------------------"
+    "----------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 012000 calibration ok\033[3;1H\033[1mch0\033[22m  29.2 \033[48;5;136m       "
+    "                                \033[0m\033[K\033[4;1H\033[1mch1\033[22m  12.9 \033[48;5;76m    "
+    "             \033[0m\033[K\033[5;1H\033[1mch2\033[22m   8.1 \033[48;5;76m           \033[0m\033["
+    "K\033[6;1H\033[1mch3\033[22m  16.6 \033[48;5;106m                      \033[0m\033[K\033[7;1H\033"
+    "[1mch4\033[22m  28.9 \033[48;5;136m                                       \033[0m\033[K\033[8;1H"
+    "\033[1mch5\033[22m  14.1 \033[48;5;76m                   \033[0m\033[K\033[9;1H\033[1mch6\033[22"
+    "m   8.1 \033[48;5;76m           \033[0m\033[K\033[10;1H\033[1mch7\033[22m   0.4 \033[48;5;46m\033"
+    "[0m\033[K\033[1;40H\033[7m    13 s\033[0m\033[12;1H\033[38;2;120;120;255m-----------------------"
+    "-----------------------------------------------------------------------------------\033[0m\033[6"
+    "0;1H\r\n"
+    "\033[32mINFO\033[0m 013000 retry 6 on bus 2\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 013001 retry 3 on bus 2\033[3;1H\033[1mch0\033[22m  27.4 \033[48;5;136m     "
+    "                                \033[0m\033[K\033[4;1H\033[1mch1\033[22m   7.0 \033[48;5;46m    "
+    "     \033[0m\033[K\033[5;1H\033[1mch2\033[22m  18.5 \033[48;5;106m                         \033["
+    "0m\033[K\033[6;1H\033[1mch3\033[22m  22.6 \033[48;5;136m                              \033[0m\033"
+    "[K\033[7;1H\033[1mch4\033[22m  20.7 \033[48;5;106m                            \033[0m\033[K\033["
+    "8;1H\033[1mch5\033[22m  18.9 \033[48;5;106m                         \033[0m\033[K\033[9;1H\033[1"
+    "mch6\033[22m  28.9 \033[48;5;136m                                       \033[0m\033[K\033[10;1H\033"
+    "[1mch7\033[22m  32.2 \033[48;5;166m                                           \033[0m\033[K\033["
+    "1;40H\033[7m    14 s\033[0m\033[12;1H\033[38;2;120;120;255m-------------------------------------"
+    "---------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 014000 watchdog fed\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 014001 buffer high water 3976\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 014002 buffer high water 2993\033[60;1H\r\n"
+    "\033[31mERR \033[0m 014003 retry 3 on bus 2\033[3;1H\033[1mch0\033[22m  16.6 \033[48;5;106m     "
+    "                 \033[0m\033[K\033[4;1H\033[1mch1\033[22m  33.3 \033[48;5;166m                  "
+    "                           \033[0m\033[K\033[5;1H\033[1mch2\033[22m   6.7 \033[48;5;46m         "
+    "\033[0m\033[K\033[6;1H\033[1mch3\033[22m  23.3 \033[48;5;136m                               \033"
+    "[0m\033[K\033[7;1H\033[1mch4\033[22m   8.1 \033[48;5;76m           \033[0m\033[K\033[8;1H\033[1m"
+    "ch5\033[22m  21.5 \033[48;5;106m                             \033[0m\033[K\033[9;1H\033[1mch6\033"
+    "[22m  15.5 \033[48;5;106m                     \033[0m\033[K\033[10;1H\033[1mch7\033[22m  18.9 \033"
+    "[48;5;106m                         \033[0m\033[K\033[1;40H\033[7m    15 s\033[0m\033[12;1H\033[3"
+    "8;2;120;120;255m--------------------------------------------------------------------------------"
+    "--------------------------\033[0m\033[60;1H\r\n"
+    "\033[31mERR \033[0m 015000 retry 7 on bus 2\033[3;1H\033[1mch0\033[22m  11.1 \033[48;5;76m      "
+    "         \033[0m\033[K\033[4;1H\033[1mch1\033[22m   7.4 \033[48;5;76m          \033[0m\033[K\033"
+    "[5;1H\033[1mch2\033[22m   1.5 \033[48;5;46m  \033[0m\033[K\033[6;1H\033[1mch3\033[22m   4.1 \033"
+    "[48;5;46m     \033[0m\033[K\033[7;1H\033[1mch4\033[22m  37.0 \033[48;5;196m                     "
+    "                             \033[0m\033[K\033[8;1H\033[1mch5\033[22m  17.8 \033[48;5;106m      "
+    "                  \033[0m\033[K\033[9;1H\033[1mch6\033[22m   4.8 \033[48;5;46m      \033[0m\033["
+    "K\033[10;1H\033[1mch7\033[22m  17.4 \033[48;5;106m                       \033[0m\033[K\033[1;40H"
+    "\033[7m    16 s\033[0m\033[12;1H\033[38;2;120;120;255m------------------------------------------"
+    "----------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 016000 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 016001 buffer high water 1476\033[3;1H\033[1mch0\033[22m  17.4 \033[48;5;106"
+    "m                       \033[0m\033[K\033[4;1H\033[1mch1\033[22m   5.5 \033[48;5;46m       \033["
+    "0m\033[K\033[5;1H\033[1mch2\033[22m  10.4 \033[48;5;76m              \033[0m\033[K\033[6;1H\033["
+    "1mch3\033[22m  15.2 \033[48;5;106m                    \033[0m\033[K\033[7;1H\033[1mch4\033[22m  "
+    "15.2 \033[48;5;106m                    \033[0m\033[K\033[8;1H\033[1mch5\033[22m  28.9 \033[48;5;"
+    "136m                                       \033[0m\033[K\033[9;1H\033[1mch6\033[22m   0.0 \033[4"
+    "8;5;46m\033[0m\033[K\033[10;1H\033[1mch7\033[22m  13.7 \033[48;5;76m                  \033[0m\033"
+    "[K\033[1;40H\033[7m    17 s\033[0m\033[12;1H\033[38;2;120;120;255m------------------------------"
+    "----------------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 017000 watchdog fed\033[3;1H\033[1mch0\033[22m  21.5 \033[48;5;106m         "
+    "                    \033[0m\033[K\033[4;1H\033[1mch1\033[22m  30.0 \033[48;5;166m               "
+    "                         \033[0m\033[K\033[5;1H\033[1mch2\033[22m  17.4 \033[48;5;106m          "
+    "             \033[0m\033[K\033[6;1H\033[1mch3\033[22m  11.8 \033[48;5;76m                \033[0m"
+    "\033[K\033[7;1H\033[1mch4\033[22m  27.0 \033[48;5;136m                                    \033[0"
+    "m\033[K\033[8;1H\033[1mch5\033[22m   7.4 \033[48;5;76m          \033[0m\033[K\033[9;1H\033[1mch6"
+    "\033[22m  37.0 \033[48;5;196m                                                  \033[0m\033[K\033"
+    "[10;1H\033[1mch7\033[22m  17.0 \033[48;5;106m                       \033[0m\033[K\033[1;40H\033["
+    "7m    18 s\033[0m\033[12;1H\033[38;2;120;120;255m-----------------------------------------------"
+    "-----------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[31mERR \033[0m 018000 buffer high water 318\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 018001 watchdog fed\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 018002 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 018003 buffer high water 3625\033[3;1H\033[1mch0\033[22m   7.8 \033[48;5;76m"
+    "          \033[0m\033[K\033[4;1H\033[1mch1\033[22m  14.1 \033[48;5;76m                   \033[0m"
+    "\033[K\033[5;1H\033[1mch2\033[22m  26.3 \033[48;5;136m                                   \033[0m"
+    "\033[K\033[6;1H\033[1mch3\033[22m   6.7 \033[48;5;46m         \033[0m\033[K\033[7;1H\033[1mch4\033"
+    "[22m   2.2 \033[48;5;46m   \033[0m\033[K\033[8;1H\033[1mch5\033[22m  31.8 \033[48;5;166m        "
+    "                                   \033[0m\033[K\033[9;1H\033[1mch6\033[22m  19.2 \033[48;5;106m"
+    "                          \033[0m\033[K\033[10;1H\033[1mch7\033[22m  29.6 \033[48;5;166m        "
+    "                                \033[0m\033[K\033[1;40H\033[7m    19 s\033[0m\033[12;1H\033[38;2"
+    ";120;120;255m-----------------------------------------------------------------------------------"
+    "-----------------------\033[0m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 019000 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 019001 calibration ok\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 019002 watchdog fed\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 019003 watchdog fed\033[3;1H\033[1mch0\033[22m  18.1 \033[48;5;106m         "
+    "               \033[0m\033[K\033[4;1H\033[1mch1\033[22m   4.8 \033[48;5;46m      \033[0m\033[K\033"
+    "[5;1H\033[1mch2\033[22m  17.4 \033[48;5;106m                       \033[0m\033[K\033[6;1H\033[1m"
+    "ch3\033[22m  23.7 \033[48;5;136m                                \033[0m\033[K\033[7;1H\033[1mch4"
+    "\033[22m   6.3 \033[48;5;46m        \033[0m\033[K\033[8;1H\033[1mch5\033[22m  27.0 \033[48;5;136"
+    "m                                    \033[0m\033[K\033[9;1H\033[1mch6\033[22m  28.9 \033[48;5;13"
+    "6m                                       \033[0m\033[K\033[10;1H\033[1mch7\033[22m  25.2 \033[48"
+    ";5;136m                                  \033[0m\033[K\033[1;40H\033[7m    20 s\033[0m\033[12;1H"
+    "\033[38;2;120;120;255m--------------------------------------------------------------------------"
+    "--------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 020000 retry 6 on bus 2\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 020001 buffer high water 1378\033[3;1H\033[1mch0\033[22m  20.4 \033[48;5;106"
+    "m                           \033[0m\033[K\033[4;1H\033[1mch1\033[22m  15.9 \033[48;5;106m       "
+    "              \033[0m\033[K\033[5;1H\033[1mch2\033[22m  18.5 \033[48;5;106m                     "
+    "    \033[0m\033[K\033[6;1H\033[1mch3\033[22m  27.0 \033[48;5;136m                               "
+    "     \033[0m\033[K\033[7;1H\033[1mch4\033[22m   3.7 \033[48;5;46m     \033[0m\033[K\033[8;1H\033"
+    "[1mch5\033[22m  22.2 \033[48;5;136m                              \033[0m\033[K\033[9;1H\033[1mch"
+    "6\033[22m  15.2 \033[48;5;106m                    \033[0m\033[K\033[10;1H\033[1mch7\033[22m   9."
+    "6 \033[48;5;76m             \033[0m\033[K\033[1;40H\033[7m    21 s\033[0m\033[12;1H\033[38;2;120"
+    ";120;255m---------------------------------------------------------------------------------------"
+    "-------------------\033[0m\033[60;1H\r\n"
+    "\033[32mINFO\033[0m 021000 retry 7 on bus 2\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 021001 calibration ok\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 021002 sample queue drained\033[3;1H\033[1mch0\033[22m  14.1 \033[48;5;76m  "
+    "                 \033[0m\033[K\033[4;1H\033[1mch1\033[22m  35.1 \033[48;5;166m                  "
+    "                             \033[0m\033[K\033[5;1H\033[1mch2\033[22m  21.8 \033[48;5;106m      "
+    "                       \033[0m\033[K\033[6;1H\033[1mch3\033[22m  24.4 \033[48;5;136m            "
+    "                     \033[0m\033[K\033[7;1H\033[1mch4\033[22m  25.2 \033[48;5;136m              "
+    "                    \033[0m\033[K\033[8;1H\033[1mch5\033[22m  28.1 \033[48;5;136m               "
+    "                       \033[0m\033[K\033[9;1H\033[1mch6\033[22m   4.4 \033[48;5;46m      \033[0m"
+    "\033[K\033[10;1H\033[1mch7\033[22m  21.1 \033[48;5;106m                            \033[0m\033[K"
+    "\033[1;40H\033[7m    22 s\033[0m\033[12;1H\033[38;2;120;120;255m--------------------------------"
+    "--------------------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 022000 calibration ok\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 022001 sample queue drained\033[3;1H\033[1mch0\033[22m  12.2 \033[48;5;76m  "
+    "              \033[0m\033[K\033[4;1H\033[1mch1\033[22m  37.0 \033[48;5;196m                     "
+    "                             \033[0m\033[K\033[5;1H\033[1mch2\033[22m   4.8 \033[48;5;46m      \033"
+    "[0m\033[K\033[6;1H\033[1mch3\033[22m  31.4 \033[48;5;166m                                       "
+    "   \033[0m\033[K\033[7;1H\033[1mch4\033[22m   0.4 \033[48;5;46m\033[0m\033[K\033[8;1H\033[1mch5\033"
+    "[22m  28.1 \033[48;5;136m                                      \033[0m\033[K\033[9;1H\033[1mch6\033"
+    "[22m  16.3 \033[48;5;106m                      \033[0m\033[K\033[10;1H\033[1mch7\033[22m  28.9 \033"
+    "[48;5;136m                                       \033[0m\033[K\033[1;40H\033[7m    23 s\033[0m\033"
+    "[12;1H\033[38;2;120;120;255m--------------------------------------------------------------------"
+    "--------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 023000 buffer high water 488\033[3;1H\033[1mch0\033[22m  24.4 \033[48;5;136m"
+    "                                 \033[0m\033[K\033[4;1H\033[1mch1\033[22m  12.2 \033[48;5;76m   "
+    "             \033[0m\033[K\033[5;1H\033[1mch2\033[22m   8.9 \033[48;5;76m            \033[0m\033"
+    "[K\033[6;1H\033[1mch3\033[22m  31.4 \033[48;5;166m                                          \033"
+    "[0m\033[K\033[7;1H\033[1mch4\033[22m   5.5 \033[48;5;46m       \033[0m\033[K\033[8;1H\033[1mch5\033"
+    "[22m   7.4 \033[48;5;76m          \033[0m\033[K\033[9;1H\033[1mch6\033[22m  18.9 \033[48;5;106m "
+    "                        \033[0m\033[K\033[10;1H\033[1mch7\033[22m  26.6 \033[48;5;136m          "
+    "                          \033[0m\033[K\033[1;40H\033[7m    24 s\033[0m\033[12;1H\033[38;2;120;1"
+    "20;255m-----------------------------------------------------------------------------------------"
+    "-----------------\033[0m\033[60;1H\r\n"
+    "\033[31mERR \033[0m 024000 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 024001 link quality 98%\033[3;1H\033[1mch0\033[22m  19.6 \033[48;5;106m     "
+    "                     \033[0m\033[K\033[4;1H\033[1mch1\033[22m   2.6 \033[48;5;46m   \033[0m\033["
+    "K\033[5;1H\033[1mch2\033[22m   4.8 \033[48;5;46m      \033[0m\033[K\033[6;1H\033[1mch3\033[22m  "
+    "35.5 \033[48;5;166m                                                \033[0m\033[K\033[7;1H\033[1m"
+    "ch4\033[22m  16.6 \033[48;5;106m                      \033[0m\033[K\033[8;1H\033[1mch5\033[22m  "
+    " 0.4 \033[48;5;46m\033[0m\033[K\033[9;1H\033[1mch6\033[22m  30.3 \033[48;5;166m                 "
+    "                        \033[0m\033[K\033[10;1H\033[1mch7\033[22m  22.9 \033[48;5;136m          "
+    "                     \033[0m\033[K\033[1;40H\033[7m    25 s\033[0m\033[12;1H\033[38;2;120;120;25"
+    "5m----------------------------------------------------------------------------------------------"
+    "------------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 025000 retry 3 on bus 2\033[60;1H\r\n"
+    "\033[31mERR \033[0m 025001 calibration ok\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 025002 link quality 96%\033[3;1H\033[1mch0\033[22m   1.5 \033[48;5;46m  \033"
+    "[0m\033[K\033[4;1H\033[1mch1\033[22m   7.0 \033[48;5;46m         \033[0m\033[K\033[5;1H\033[1mch"
+    "2\033[22m   3.0 \033[48;5;46m    \033[0m\033[K\033[6;1H\033[1mch3\033[22m  22.2 \033[48;5;136m  "
+    "                            \033[0m\033[K\033[7;1H\033[1mch4\033[22m   1.5 \033[48;5;46m  \033[0"
+    "m\033[K\033[8;1H\033[1mch5\033[22m  15.2 \033[48;5;106m                    \033[0m\033[K\033[9;1"
+    "H\033[1mch6\033[22m  26.6 \033[48;5;136m                                    \033[0m\033[K\033[10"
+    ";1H\033[1mch7\033[22m   3.0 \033[48;5;46m    \033[0m\033[K\033[1;40H\033[7m    26 s\033[0m\033[1"
+    "2;1H\033[38;2;120;120;255m----------------------------------------------------------------------"
+    "------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[31mERR \033[0m 026000 watchdog fed\033[60;1H\r\n"
+    "\033[31mERR \033[0m 026001 buffer high water 3788\033[3;1H\033[1mch0\033[22m   0.4 \033[48;5;46m"
+    "\033[0m\033[K\033[4;1H\033[1mch1\033[22m  16.6 \033[48;5;106m                      \033[0m\033[K"
+    "\033[5;1H\033[1mch2\033[22m  24.4 \033[48;5;136m                                 \033[0m\033[K\033"
+    "[6;1H\033[1mch3\033[22m  26.6 \033[48;5;136m                                    \033[0m\033[K\033"
+    "[7;1H\033[1mch4\033[22m  12.9 \033[48;5;76m                 \033[0m\033[K\033[8;1H\033[1mch5\033"
+    "[22m  36.3 \033[48;5;166m                                                 \033[0m\033[K\033[9;1H"
+    "\033[1mch6\033[22m   5.5 \033[48;5;46m       \033[0m\033[K\033[10;1H\033[1mch7\033[22m  22.9 \033"
+    "[48;5;136m                               \033[0m\033[K\033[1;40H\033[7m    27 s\033[0m\033[12;1H"
+    "\033[38;2;120;120;255m--------------------------------------------------------------------------"
+    "--------------------------------\033[0m\033[60;1H\r\n"
+    "\033[36mDBG \033[0m 027000 buffer high water 2090\033[3;1H\033[1mch0\033[22m  18.5 \033[48;5;106"
+    "m                         \033[0m\033[K\033[4;1H\033[1mch1\033[22m  25.5 \033[48;5;136m         "
+    "                         \033[0m\033[K\033[5;1H\033[1mch2\033[22m  18.1 \033[48;5;106m          "
+    "              \033[0m\033[K\033[6;1H\033[1mch3\033[22m  27.8 \033[48;5;136m                     "
+    "                \033[0m\033[K\033[7;1H\033[1mch4\033[22m   1.9 \033[48;5;46m  \033[0m\033[K\033["
+    "8;1H\033[1mch5\033[22m  14.4 \033[48;5;76m                   \033[0m\033[K\033[9;1H\033[1mch6\033"
+    "[22m  28.9 \033[48;5;136m                                       \033[0m\033[K\033[10;1H\033[1mch"
+    "7\033[22m  30.3 \033[48;5;166m                                         \033[0m\033[K\033[1;40H\033"
+    "[7m    28 s\033[0m\033[12;1H\033[38;2;120;120;255m----------------------------------------------"
+    "------------------------------------------------------------\033[0m\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 028000 sample queue drained\033[3;1H\033[1mch0\033[22m  12.6 \033[48;5;76m  "
+    "               \033[0m\033[K\033[4;1H\033[1mch1\033[22m  29.2 \033[48;5;136m                    "
+    "                   \033[0m\033[K\033[5;1H\033[1mch2\033[22m  32.9 \033[48;5;166m                "
+    "                            \033[0m\033[K\033[6;1H\033[1mch3\033[22m  32.9 \033[48;5;166m       "
+    "                                     \033[0m\033[K\033[7;1H\033[1mch4\033[22m  27.8 \033[48;5;13"
+    "6m                                     \033[0m\033[K\033[8;1H\033[1mch5\033[22m  10.7 \033[48;5;"
+    "76m              \033[0m\033[K\033[9;1H\033[1mch6\033[22m   4.1 \033[48;5;46m     \033[0m\033[K\033"
+    "[10;1H\033[1mch7\033[22m  33.7 \033[48;5;166m                                             \033[0"
+    "m\033[K\033[1;40H\033[7m    29 s\033[0m\033[12;1H\033[38;2;120;120;255m-------------------------"
+    "---------------------------------------------------------------------------------\033[0m\033[60;"
+    "1H\r\n"
+    "\033[31mERR \033[0m 029000 buffer high water 171\033[60;1H\r\n"
+    "\033[31mERR \033[0m 029001 sample queue drained\033[60;1H\r\n"
+    "\033[33mWARN\033[0m 029002 sample queue drained\033[r\033[\?25h\033[60;1H";
+
+const term_log_t term_logs[TERM_LOG_COUNT] = {
+    {"ls", log_ls, sizeof(log_ls) - 1},
+    {"diff", log_diff, sizeof(log_diff) - 1},
+    {"dashboard", log_dashboard, sizeof(log_dashboard) - 1},
+};
@@ -0,0 +1,25 @@
+/**
+ * Recorded terminal output used to benchmark the terminal
+ *
+ * Real output captured from a Linux shell with colors forced on, plus a
+ * cursor-addressed dashboard of the kind a monitoring tool draws. Stored in
+ * flash.
+ */
+
+#ifndef TERM_LOGS_H
+#define TERM_LOGS_H
+
+#include <stdint.h>
+
+#define TERM_LOG_COUNT 3
+
+typedef struct
+{
+    const char *name;
+    const char *data;
+    uint32_t length;
+} term_log_t;
+
+extern const term_log_t term_logs[TERM_LOG_COUNT];
+
+#endif
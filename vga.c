@@ -18,43 +18,130 @@
  *  - RP2040 GND ---> VGA GND
  *
  * RESOURCES USED
- *  - PIO state machines 0, 1, and 2 on PIO instance 0
- *  - DMA channels 0 and 1
- *  - 614.4 kBytes of RAM (for pixel color data)
+ *  - PIO state machines 0 (sync) and 1 (rgb) on PIO instance 0, 29 of its
+ *    instruction slots, or up to 31 while a pattern from pattern.pio takes
+ *    the place of rgb
+ *  - DMA channels 0 and 1, and the DMA sniffer (on channel 0)
+ *  - DMA_IRQ_0 (end of each line)
+ *  - IO_IRQ_BANK0 with the GPIO callback, on the vsync pin while a pattern
+ *    shows
+ *  - 245.76 kBytes of RAM (for pixel color data) and 1.92 kBytes for the
+ *    line table; with VGA_BANKED_SRAM, SRAM0-2 and most of SRAM3
+ *  - DMA has bus priority over the cores
  *
  * HOW TO USE THIS CODE
  *  This code uses one DMA channel to send pixel data to a PIO state machine
- *  that is driving the VGA display, and a second DMA channel to reconfigure
- *  and restart the first. As such, changing any value in the pixel color
- *  array will be automatically reflected on the VGA display screen.
+ *  that is driving the VGA display, one line at a time, and a second DMA
+ *  channel that restarts the first with the next entry of vga_line_table. As
+ *  such, changing any value in the pixel color array will be automatically
+ *  reflected on the VGA display screen, and reordering the line table scrolls
+ *  the display without moving any pixels.
  *
  *  To help with this, I have included a function called drawPixel which takes,
  *  as arguments, a VGA x-coordinate (int), a VGA y-coordinate (int), and a
  *  pixel color (char). Only 6 bits are used for RGB, so there are only 64 possible
- *  colors. If you keep all of the code above line 124, this interface will work.
+ *  colors. If you keep initVGA() and drawPixel(), this interface will work.
+ *
+ *  The DMA sniffer computes a CRC of every frame as it is sent, so
+ *  vga_frame_changed_since() tells whether anything was drawn without the
+ *  CPU reading the framebuffer.
+ *
+ *  Sending 'c' over USB serial streams a compressed screenshot of the
+ *  display, see capture.h and host/vgacap.cpp.
+ *
+ *  Sending 'b' runs the benchmarks in bench.c and prints the results.
+ *  Sending 's' switches to 800x600 for a few seconds and checks that
+ *  scan-out keeps up there, see svga.h.
+ *  Sending 'p' steps through the test patterns of vga_show_test_pattern(),
+ *  which need no framebuffer or DMA; any other command goes back to the
+ *  framebuffer first. Building with VGA_BOOT_PATTERN starts with one, which
+ *  the gpu and term apps also leave on their first input.
+ *
+ *  Built with VGA_APP=gpu the Pico instead draws commands sent by a host,
+ *  see gpu.h. With VGA_APP=term it is an ANSI terminal for whatever is
+ *  written to the USB serial port, see term.h.
  *
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
 #include "hardware/dma.h"
-#include "hsync.pio.h"
-#include "vsync.pio.h"
+#include "hardware/irq.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "sync.pio.h"
 #include "rgb.pio.h"
+#include "pattern.pio.h"
+#include "vga.h"
+#include "capture.h"
+#include "cursor.h"
+#include "gpu.h"
+#include "term.h"
+#include "bench.h"
 
-#define H_ACTIVE 655   // 640+16-1
-#define V_ACTIVE 479   // 480-1
 #define RGB_ACTIVE 127 // 640/5-1
-#define RED_PIN 0
-#define HSYNC 6
-#define VSYNC 7
-#define TXCOUNT 61440
 
+// With VGA_BANKED_SRAM memmap_vga.ld gives the framebuffer SRAM banks of its
+// own, see there
+#ifdef VGA_BANKED_SRAM
+uint32_t vga_data_array[TXCOUNT] __attribute__((section(".framebuffer")));
+#else
 uint32_t vga_data_array[TXCOUNT];
-uint32_t *address_pointer = &vga_data_array[0];
+#endif
+uint32_t *vga_line_table[VGA_HEIGHT];
+
+#define BAND_LINES (VGA_HEIGHT / VGA_CRC_BANDS)
+#define CRC_SEED 0xffffffff
+
+static const int rgb_chan_0 = 0;
+static const int rgb_chan_1 = 1;
+static const uint sync_sm = 0;
+static const uint rgb_sm = 1;
+static uint sync_offset, rgb_offset;
+static volatile uint32_t frame_count = 0;
+static volatile uint32_t underruns = 0;
+static uint32_t rgb_stall_bit; // the rgb state machine's TXSTALL flag in FDEBUG
+
+// The test pattern on the rgb state machine instead of the rgb program, if any
+static vga_test_pattern_t test_pattern = VGA_TEST_NONE;
+static uint pattern_offset;
+
+static const pio_program_t *const pattern_programs[VGA_TEST_PATTERNS] = {
+    [VGA_TEST_SOLID] = &pattern_solid_program,
+    [VGA_TEST_BARS] = &pattern_bars_program,
+    [VGA_TEST_GRID] = &pattern_grid_program,
+    [VGA_TEST_CHECKER] = &pattern_checker_program,
+};
 
-void drawPixel(int x, int y, char color)
+static const char bar_colors[8] = {
+    VGA_RGB(3, 3, 3), VGA_RGB(3, 3, 0), VGA_RGB(0, 3, 3), VGA_RGB(0, 3, 0),
+    VGA_RGB(3, 0, 3), VGA_RGB(3, 0, 0), VGA_RGB(0, 0, 3), VGA_RGB(0, 0, 0),
+};
+
+// Set while channel 1 is going to load the next line into channel 0 without
+// starting it, at the end of each band
+static bool paused;
+
+static uint32_t band_crc[VGA_CRC_BANDS];
+static volatile uint32_t band_changed[VGA_CRC_BANDS]; // frame each band last changed in
+static volatile uint32_t frame_crc;
+static volatile uint32_t frame_changed;
+static bool frame_dirty;
+
+// The line table channel 1 walks this frame, and the one for the next
+static uint32_t *const *frame_table = vga_line_table;
+static uint32_t *const *volatile scan_table = vga_line_table;
+
+// Lines channel 0 has finished sending since initVGA()
+static volatile uint32_t scan_position;
+
+// Channel 1 loads a cursor line from here instead of the table, and then
+// goes on with entry cursor_resume of it
+static uint32_t *cursor_slot;
+static uint32_t cursor_resume;
+
+void VGA_RAM_FUNC(drawPixel)(int x, int y, char color)
 {
     if (x > 639)
         x = 639;
@@ -65,68 +152,338 @@ void drawPixel(int x, int y, char color)
     if (y > 479)
         y = 479;
 
-    int pixel = ((640 * y) + x);
     // Put 5 pixel values into a single 32-bit integer
-    vga_data_array[pixel / 5] |= (color << (24 - ((pixel % 5) * 6)));
+    uint32_t *word = &vga_row(y)[x / 5];
+    int shift = VGA_PIXEL_SHIFT(x % 5);
+    *word = (*word & ~(VGA_PIXEL_MASK << shift)) | ((color & VGA_PIXEL_MASK) << shift);
 }
 
-int main()
+// Channel 1 is going to load line y of the table next. If the cursor is on
+// it, have it load the line with the cursor merged in instead.
+static inline void send_cursor(uint32_t y)
+{
+    uint32_t *line = cursor_line(y, frame_table[y]);
+    if (line)
+    {
+        cursor_slot = line;
+        cursor_resume = y + 1;
+        dma_hw->ch[rgb_chan_1].read_addr = (uint32_t)&cursor_slot;
+    }
+}
+
+// Channel 0 has sent the last word of a line to the PIO and the chain to
+// channel 1 has already restarted it on the next line, unless the line ended
+// a band. Then channel 0 is stopped so the sniffer holds the exact CRC of the
+// band, and restarted here. The rgb state machine is still busy with the
+// horizontal blanking, so this costs nothing on screen.
+static void __not_in_flash_func(dma_handler)()
+{
+    dma_hw->ints0 = 1u << rgb_chan_0;
+
+    // Channel 1 may still be finishing its single transfer
+    while (dma_channel_is_busy(rgb_chan_1))
+        tight_loop_contents();
+
+    uint32_t next;
+    if (dma_hw->ch[rgb_chan_1].read_addr == (uint32_t)(&cursor_slot + 1))
+    {
+        next = cursor_resume;
+        dma_hw->ch[rgb_chan_1].read_addr = (uint32_t)&frame_table[next];
+    }
+    else
+        next = (dma_hw->ch[rgb_chan_1].read_addr - (uint32_t)frame_table) / sizeof(uint32_t *);
+    scan_position++;
+
+    // The rgb state machine only waits on an empty FIFO if the DMA fell behind
+    if (pio0->fdebug & rgb_stall_bit)
+    {
+        pio0->fdebug = rgb_stall_bit;
+        underruns++;
+    }
+
+    if (paused)
+    {
+        uint32_t crc = dma_hw->sniff_data;
+        dma_hw->sniff_data = CRC_SEED;
+        dma_hw->ch[rgb_chan_1].write_addr = (uint32_t)&dma_hw->ch[rgb_chan_0].al3_read_addr_trig;
+        dma_start_channel_mask(1u << rgb_chan_0);
+        paused = false;
+
+        // Channel 1 has loaded line next - 1, the first of the next band
+        int band = next == 1 ? VGA_CRC_BANDS - 1 : (next - 1) / BAND_LINES - 1;
+        if (crc != band_crc[band])
+        {
+            band_crc[band] = crc;
+            band_changed[band] = frame_count + 1;
+            frame_dirty = true;
+        }
+
+        if (band == VGA_CRC_BANDS - 1)
+        {
+            uint32_t all = 0;
+            for (int i = 0; i < VGA_CRC_BANDS; i++)
+                all ^= (band_crc[i] << i) | (band_crc[i] >> ((32 - i) & 31));
+            frame_crc = all;
+            if (frame_dirty)
+                frame_changed = frame_count + 1;
+            frame_dirty = false;
+            frame_count++;
+        }
+        send_cursor(next);
+        return;
+    }
+
+    // Channel 0 is sending line next - 1. When that is the last of a band,
+    // have channel 1 load the following line without triggering.
+    if (next % BAND_LINES == 0)
+    {
+        if (next == VGA_HEIGHT)
+        {
+            frame_table = scan_table;
+            dma_hw->ch[rgb_chan_1].read_addr = (uint32_t)frame_table;
+            cursor_latch();
+            next = 0;
+        }
+        dma_hw->ch[rgb_chan_1].write_addr = (uint32_t)&dma_hw->ch[rgb_chan_0].read_addr;
+        paused = true;
+    }
+    send_cursor(next);
+}
+
+uint32_t vga_frame_count(void)
+{
+    return frame_count;
+}
+
+uint32_t vga_underruns(void)
+{
+    return underruns;
+}
+
+uint32_t vga_frame_crc(void)
+{
+    return frame_crc;
+}
+
+bool vga_frame_changed_since(uint32_t frame)
+{
+    return (int32_t)(frame_changed - frame) > 0;
+}
+
+uint32_t vga_band_crc(int band)
+{
+    return band_crc[band];
+}
+
+bool vga_band_changed_since(int band, uint32_t frame)
+{
+    return (int32_t)(band_changed[band] - frame) > 0;
+}
+
+uint32_t vga_scan_position(void)
+{
+    return scan_position;
+}
+
+void vga_set_scan_table(uint32_t *const *table)
+{
+    scan_table = table ? table : vga_line_table;
+}
+
+// While a pattern shows there is no DMA to count frames, so the start of
+// vsync (falling, as 640x480 has negative sync) does
+static void __not_in_flash_func(vsync_edge)(uint gpio, uint32_t events)
+{
+    frame_count++;
+    scan_position = frame_count * VGA_HEIGHT;
+}
+
+void vga_wait_vblank(void)
+{
+    uint32_t frame = frame_count;
+    while (frame_count == frame)
+        tight_loop_contents();
+}
+
+// Start the state machines and the DMA at the first line of a frame
+static void start_scan_out(void)
 {
-    stdio_init_all();
     PIO pio = pio0;
 
-    uint hsync_offset = pio_add_program(pio, &hsync_program);
-    uint vsync_offset = pio_add_program(pio, &vsync_program);
-    uint rgb_offset = pio_add_program(pio, &rgb_program);
+    sync_program_init(pio, sync_sm, sync_offset, VGA_HSYNC_PIN, VGA_VSYNC_PIN, sync_frame(VGA_HEIGHT, 1, 2, 32));
+    rgb_program_init(pio, rgb_sm, rgb_offset, VGA_RED_PIN);
+
+    frame_table = scan_table;
+    paused = false;
+    dma_hw->ch[rgb_chan_1].read_addr = (uint32_t)frame_table;
+    dma_hw->ch[rgb_chan_1].write_addr = (uint32_t)&dma_hw->ch[rgb_chan_0].al3_read_addr_trig;
+    dma_sniffer_set_data_accumulator(CRC_SEED);
+
+    pio_sm_put_blocking(pio, rgb_sm, RGB_ACTIVE);
+    pio->fdebug = rgb_stall_bit;
+    pio_enable_sm_mask_in_sync(pio, ((1u << sync_sm) | (1u << rgb_sm)));
+    dma_start_channel_mask((1u << rgb_chan_1));
+}
+
+// Start the sync state machine with a pattern program on the rgb one, and
+// leave the DMA alone
+static void start_pattern(vga_test_pattern_t p, char color0, char color1)
+{
+    PIO pio = pio0;
+
+    // The patterns and rgb take turns in the instruction memory
+    pio_remove_program(pio, &rgb_program, rgb_offset);
+    pattern_offset = pio_add_program(pio, pattern_programs[p]);
+    test_pattern = p;
+
+    sync_program_init(pio, sync_sm, sync_offset, VGA_HSYNC_PIN, VGA_VSYNC_PIN, sync_frame(VGA_HEIGHT, 1, 2, 32));
+    switch (p)
+    {
+    case VGA_TEST_SOLID:
+        pattern_solid_program_init(pio, rgb_sm, pattern_offset, VGA_RED_PIN, color0);
+        break;
+    case VGA_TEST_BARS:
+        pattern_bars_program_init(pio, rgb_sm, pattern_offset, VGA_RED_PIN, bar_colors);
+        break;
+    case VGA_TEST_GRID:
+        pattern_grid_program_init(pio, rgb_sm, pattern_offset, VGA_RED_PIN, color0, color1);
+        break;
+    default:
+        pattern_checker_program_init(pio, rgb_sm, pattern_offset, VGA_RED_PIN, color0, color1);
+        break;
+    }
+    pio_enable_sm_mask_in_sync(pio, ((1u << sync_sm) | (1u << rgb_sm)));
+    gpio_set_irq_enabled_with_callback(VGA_VSYNC_PIN, GPIO_IRQ_EDGE_FALL, true, vsync_edge);
+}
+
+// Stop the pattern and put the rgb program back
+static void stop_pattern(void)
+{
+    gpio_set_irq_enabled(VGA_VSYNC_PIN, GPIO_IRQ_EDGE_FALL, false);
+    pio_set_sm_mask_enabled(pio0, (1u << sync_sm) | (1u << rgb_sm), false);
+    pio_remove_program(pio0, pattern_programs[test_pattern], pattern_offset);
+    rgb_offset = pio_add_program(pio0, &rgb_program);
+    test_pattern = VGA_TEST_NONE;
+}
+
+void initVGA(void)
+{
+    PIO pio = pio0;
 
-    uint hsync_sm = 0;
-    uint vsync_sm = 1;
-    uint rgb_sm = 2;
+    sync_offset = pio_add_program(pio, &sync_program);
+    rgb_offset = pio_add_program(pio, &rgb_program);
 
-    hsync_program_init(pio, hsync_sm, hsync_offset, HSYNC);
-    vsync_program_init(pio, vsync_sm, vsync_offset, VSYNC);
-    rgb_program_init(pio, rgb_sm, rgb_offset, RED_PIN);
+    memset(vga_data_array, 0, sizeof(vga_data_array));
+    for (int y = 0; y < VGA_HEIGHT; y++)
+        vga_line_table[y] = &vga_data_array[y * VGA_LINE_WORDS];
 
-    int rgb_chan_0 = 0;
-    int rgb_chan_1 = 1;
+    // Scan-out wins when the DMA and a core want the same SRAM bank
+    bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS;
 
     dma_channel_config c0 = dma_channel_get_default_config(rgb_chan_0); // default configs
     channel_config_set_transfer_data_size(&c0, DMA_SIZE_32);            // 8-bit txfers
     channel_config_set_read_increment(&c0, true);                       // yes read incrementing
     channel_config_set_write_increment(&c0, false);                     // no write incrementing
-    channel_config_set_dreq(&c0, DREQ_PIO0_TX2);                        // DREQ_PIO0_TX2 pacing (FIFO)
+    channel_config_set_dreq(&c0, DREQ_PIO0_TX1);                        // DREQ_PIO0_TX1 pacing (FIFO)
     channel_config_set_chain_to(&c0, rgb_chan_1);                       // chain to other channel
+    channel_config_set_sniff_enable(&c0, true);                         // CRC what is sent
 
     dma_channel_configure(
         rgb_chan_0,        // Channel to be configured
         &c0,               // The configuration we just created
         &pio->txf[rgb_sm], // write address (RGB PIO TX FIFO)
         &vga_data_array,   // The initial read address (pixel color array)
-        TXCOUNT,           // Number of transfers; in this case each is 4 bytes.
+        VGA_LINE_WORDS,    // Number of transfers (one line); each is 4 bytes.
         false              // Don't start immediately.
     );
 
     // Channel One (reconfigures the first channel)
     dma_channel_config c1 = dma_channel_get_default_config(rgb_chan_1); // default configs
     channel_config_set_transfer_data_size(&c1, DMA_SIZE_32);            // 32-bit txfers
-    channel_config_set_read_increment(&c1, false);                      // no read incrementing
+    channel_config_set_read_increment(&c1, true);                       // walk the line table
     channel_config_set_write_increment(&c1, false);                     // no write incrementing
-    channel_config_set_chain_to(&c1, rgb_chan_0);                       // chain to other channel
+                                                                        // writing the trigger alias starts channel 0
 
     dma_channel_configure(
-        rgb_chan_1,                        // Channel to be configured
-        &c1,                               // The configuration we just created
-        &dma_hw->ch[rgb_chan_0].read_addr, // Write address (channel 0 read address)
-        &address_pointer,                  // Read address (POINTER TO AN ADDRESS)
-        1,                                 // Number of transfers, in this case each is 4 byte
-        false                              // Don't start immediately.
+        rgb_chan_1,                                  // Channel to be configured
+        &c1,                                         // The configuration we just created
+        &dma_hw->ch[rgb_chan_0].al3_read_addr_trig, // Write address (channel 0 read address and trigger)
+        vga_line_table,                              // Read address (POINTERS TO LINES)
+        1,                                           // Number of transfers, in this case each is 4 byte
+        false                                        // Don't start immediately.
     );
 
-    pio_sm_put_blocking(pio, hsync_sm, H_ACTIVE);
-    pio_sm_put_blocking(pio, vsync_sm, V_ACTIVE);
-    pio_sm_put_blocking(pio, rgb_sm, RGB_ACTIVE);
-    pio_enable_sm_mask_in_sync(pio, ((1u << hsync_sm) | (1u << vsync_sm) | (1u << rgb_sm)));
-    dma_start_channel_mask((1u << rgb_chan_0));
+    dma_sniffer_enable(rgb_chan_0, DMA_SNIFF_CTRL_CALC_VALUE_CRC32, true);
+
+    // Track lines as channel 0 finishes them, this has to run within a line
+    dma_channel_set_irq0_enabled(rgb_chan_0, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
+    irq_set_priority(DMA_IRQ_0, PICO_HIGHEST_IRQ_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    rgb_stall_bit = 1u << (PIO_FDEBUG_TXSTALL_LSB + rgb_sm);
+    if (VGA_BOOT_PATTERN != VGA_TEST_NONE)
+        start_pattern(VGA_BOOT_PATTERN, VGA_BOOT_COLOR0, VGA_BOOT_COLOR1);
+    else
+        start_scan_out();
+}
+
+void vga_pause(void)
+{
+    vga_wait_vblank();
+    if (test_pattern != VGA_TEST_NONE)
+    {
+        stop_pattern();
+        return;
+    }
+    pio_set_sm_mask_enabled(pio0, (1u << sync_sm) | (1u << rgb_sm), false);
+
+    // Without the chain, aborting channel 0 can't start channel 1 again
+    dma_channel_set_irq0_enabled(rgb_chan_0, false);
+    hw_write_masked(&dma_hw->ch[rgb_chan_0].al1_ctrl, rgb_chan_0 << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_abort(rgb_chan_1);
+    dma_channel_abort(rgb_chan_0);
+    dma_hw->ints0 = 1u << rgb_chan_0;
+}
+
+void vga_resume(void)
+{
+    hw_write_masked(&dma_hw->ch[rgb_chan_0].al1_ctrl, rgb_chan_1 << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_set_irq0_enabled(rgb_chan_0, true);
+    scan_position = frame_count * VGA_HEIGHT;
+    start_scan_out();
+}
+
+void vga_show_test_pattern(vga_test_pattern_t p, char color0, char color1)
+{
+    if (p == test_pattern || p < 0 || p >= VGA_TEST_PATTERNS)
+        return;
+
+    vga_pause();
+    if (p == VGA_TEST_NONE)
+        vga_resume();
+    else
+        start_pattern(p, color0, color1);
+}
+
+vga_test_pattern_t vga_test_pattern(void)
+{
+    return test_pattern;
+}
+
+int main()
+{
+    stdio_init_all();
+    initVGA();
+
+#ifdef VGA_APP_GPU
+    gpu_run();
+#endif
+#ifdef VGA_APP_TERM
+    term_run();
+#endif
 
     while (true)
     {
@@ -155,5 +512,20 @@ int main()
                 drawPixel(x, y, index);
             }
         }
+
+        int c = getchar_timeout_us(0);
+        if (c > 0 && c != 'p' && test_pattern != VGA_TEST_NONE)
+            vga_show_test_pattern(VGA_TEST_NONE, 0, 0);
+
+        if (c == 'p')
+            vga_show_test_pattern((test_pattern + 1) % VGA_TEST_PATTERNS, VGA_BOOT_COLOR0, VGA_BOOT_COLOR1);
+        else if (c == 'c')
+            vga_capture();
+        else if (c == 'b')
+            bench_run();
+        else if (c == 'w')
+            bench_workloads();
+        else if (c == 's')
+            bench_svga();
     }
 }
@@ -0,0 +1,152 @@
+/**
+ * VGA driver interface
+ *
+ * See vga.c for hardware connections and resources used.
+ */
+
+#ifndef VGA_H
+#define VGA_H
+
+#include "pico/stdlib.h"
+#include "pixel.h"
+
+// GPIO 0-5 carry red, green and blue, high bit first
+#define VGA_RED_PIN 0
+#define VGA_HSYNC_PIN 6
+#define VGA_VSYNC_PIN 7
+
+#define VGA_WIDTH 640
+#define VGA_HEIGHT 480
+#define VGA_LINE_WORDS 128 // 640/5
+#define TXCOUNT 61440      // VGA_LINE_WORDS * VGA_HEIGHT
+
+// Number of horizontal bands the screen is split into for change detection,
+// must divide VGA_HEIGHT and leave at least 2 lines per band
+#ifndef VGA_CRC_BANDS
+#define VGA_CRC_BANDS 1
+#endif
+
+// Drawing code and its tables run from flash through the 16 kB XIP cache,
+// unless built with VGA_RAM_FUNCS which has the startup code copy them to
+// SRAM. Interrupt handlers are always in SRAM.
+#ifdef VGA_RAM_FUNCS
+#define VGA_RAM_FUNC(f) __not_in_flash_func(f)
+#define VGA_RAM_DATA(group) __not_in_flash(group)
+#else
+#define VGA_RAM_FUNC(f) f
+#define VGA_RAM_DATA(group)
+#endif
+
+extern uint32_t vga_data_array[TXCOUNT];
+
+// Where each screen line is fetched from. Initially line y points at row y
+// of vga_data_array. The entries may be permuted (but every one must stay a
+// row of vga_data_array) to scroll without copying pixels; drawing follows
+// the table so coordinates always refer to the screen.
+extern uint32_t *vga_line_table[VGA_HEIGHT];
+
+// An offscreen image in the same packed format as the screen. Every row
+// starts on a word boundary.
+typedef struct
+{
+    uint32_t *words;
+    short width;
+    short height;
+    short stride; // words per row
+} vga_surface_t;
+
+// An image with one pixel per byte (upper 2 bits clear) and power of two
+// dimensions, used by the affine blits. Coordinates wrap around.
+typedef struct
+{
+    const uint8_t *pixels;
+    uint8_t width_bits; // width is 1 << width_bits
+    uint8_t height_bits;
+} vga_texture_t;
+
+// Words of a row of the screen
+static inline uint32_t *vga_row(int y)
+{
+    return vga_line_table[y];
+}
+
+static inline uint32_t *surfaceRow(const vga_surface_t *s, int y)
+{
+    return &s->words[y * s->stride];
+}
+
+// Set up the PIO state machines and DMA channels and start scan-out
+void initVGA(void);
+
+void drawPixel(int x, int y, char color);
+
+// Number of frames scanned out since initVGA()
+uint32_t vga_frame_count(void);
+
+// Lines on which the rgb state machine ran out of data since initVGA()
+uint32_t vga_underruns(void);
+
+// The frame CRC is computed by the DMA sniffer while the frame is scanned out
+// and latched at the end of it. It is the CRC-32 of the words sent, without
+// the final inversion, or with several bands the band CRCs combined.
+uint32_t vga_frame_crc(void);
+
+// Whether the picture changed after frame, a value of vga_frame_count().
+// Changes show up once the frame they were drawn in has been scanned out.
+bool vga_frame_changed_since(uint32_t frame);
+
+// The same for band 0 to VGA_CRC_BANDS - 1, lines band * VGA_HEIGHT /
+// VGA_CRC_BANDS onward
+uint32_t vga_band_crc(int band);
+bool vga_band_changed_since(int band, uint32_t frame);
+
+// Lines sent since initVGA(). Every frame has VGA_HEIGHT of them, so line y
+// of frame f (a value of vga_frame_count()) is number f * VGA_HEIGHT + y,
+// and it is being sent while this returns that number.
+uint32_t vga_scan_position(void);
+
+// Scan out through another table of line pointers from the next frame on,
+// or vga_line_table again for NULL. Drawing still goes through
+// vga_line_table. The compositor uses this to send line buffers.
+void vga_set_scan_table(uint32_t *const *table);
+
+// Block until the current frame has been sent to the PIO
+void vga_wait_vblank(void);
+
+// Stop scan-out at the start of a frame, and start it again with the next
+// frame from the first line, for another mode to use the pins. Frame and line
+// counts don't move meanwhile. The compositor and cursor must not be running.
+// Pausing a test pattern drops it, so resuming shows the framebuffer.
+void vga_pause(void);
+void vga_resume(void);
+
+// Patterns the PIO makes on its own, with no framebuffer or DMA behind them
+typedef enum
+{
+    VGA_TEST_NONE,    // the framebuffer
+    VGA_TEST_SOLID,   // color0 all over
+    VGA_TEST_BARS,    // 8 bars, white, yellow, cyan, green, magenta, red, blue, black
+    VGA_TEST_GRID,    // lines of color1 every 32 pixels and lines on color0
+    VGA_TEST_CHECKER, // 20x20 squares of color0 and color1
+    VGA_TEST_PATTERNS
+} vga_test_pattern_t;
+
+// The pattern initVGA() starts with, instead of the framebuffer
+#ifndef VGA_BOOT_PATTERN
+#define VGA_BOOT_PATTERN VGA_TEST_NONE
+#endif
+#ifndef VGA_BOOT_COLOR0
+#define VGA_BOOT_COLOR0 VGA_RGB(3, 3, 3)
+#endif
+#ifndef VGA_BOOT_COLOR1
+#define VGA_BOOT_COLOR1 VGA_RGB(0, 0, 0)
+#endif
+
+// Show a pattern instead of the framebuffer, or the framebuffer again for
+// VGA_TEST_NONE, at the end of a frame. While a pattern shows the DMA is
+// idle; frames are counted from the vsync pin instead and the line count
+// moves a frame at a time, so vga_wait_vblank() and vga_pause() still work.
+void vga_show_test_pattern(vga_test_pattern_t pattern, char color0, char color1);
+vga_test_pattern_t vga_test_pattern(void);
+
+#endif
@@ -0,0 +1,314 @@
+/**
+ * Overlapping windows on the framebuffer, see wm.h
+ */
+
+#include "gfx.h"
+#include "wm.h"
+
+typedef struct
+{
+    wm_rect_t r;
+    const vga_surface_t *surface;
+    wm_paint_t paint;
+    void *ctx;
+    bool open;
+} window_t;
+
+// Disjoint rectangles. overflow is set when one had to be left out.
+typedef struct
+{
+    int count;
+    bool overflow;
+    wm_rect_t rects[WM_MAX_RECTS];
+} region_t;
+
+static window_t windows[WM_MAX_WINDOWS];
+
+// Ids of the open windows, bottom first
+static int order[WM_MAX_WINDOWS];
+static int count;
+
+static char background;
+static uint32_t overflows;
+
+// Lists are static to keep them off core 0's small stack, so none of this
+// is reentrant
+static region_t lists[3];
+
+static const wm_rect_t screen = {0, 0, VGA_WIDTH, VGA_HEIGHT};
+
+static bool intersect(const wm_rect_t *a, const wm_rect_t *b, wm_rect_t *out)
+{
+    int x0 = a->x > b->x ? a->x : b->x;
+    int y0 = a->y > b->y ? a->y : b->y;
+    int x1 = a->x + a->w < b->x + b->w ? a->x + a->w : b->x + b->w;
+    int y1 = a->y + a->h < b->y + b->h ? a->y + a->h : b->y + b->h;
+
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    *out = (wm_rect_t){x0, y0, x1 - x0, y1 - y0};
+    return true;
+}
+
+static void append(region_t *region, int x, int y, int w, int h)
+{
+    if (region->count == WM_MAX_RECTS)
+        region->overflow = true;
+    else
+        region->rects[region->count++] = (wm_rect_t){x, y, w, h};
+}
+
+// Set region to the single rectangle r, cut to the screen
+static void set(region_t *region, const wm_rect_t *r)
+{
+    wm_rect_t on;
+
+    region->count = 0;
+    region->overflow = false;
+    if (intersect(r, &screen, &on))
+        region->rects[region->count++] = on;
+}
+
+// Write what is left of src after taking out s to dst, as up to four
+// rectangles for each one s overlaps: the full width parts above and below,
+// and the parts left and right of it
+static void subtract(const region_t *src, const wm_rect_t *s, region_t *dst)
+{
+    dst->count = 0;
+    dst->overflow = src->overflow;
+    for (int i = 0; i < src->count; i++)
+    {
+        const wm_rect_t *a = &src->rects[i];
+        wm_rect_t in;
+
+        if (!intersect(a, s, &in))
+        {
+            append(dst, a->x, a->y, a->w, a->h);
+            continue;
+        }
+        if (in.y > a->y)
+            append(dst, a->x, a->y, a->w, in.y - a->y);
+        if (in.y + in.h < a->y + a->h)
+            append(dst, a->x, in.y + in.h, a->w, a->y + a->h - in.y - in.h);
+        if (in.x > a->x)
+            append(dst, a->x, in.y, in.x - a->x, in.h);
+        if (in.x + in.w < a->x + a->w)
+            append(dst, in.x + in.w, in.y, a->x + a->w - in.x - in.w, in.h);
+    }
+}
+
+static void paint(const window_t *win, const wm_rect_t *clip)
+{
+    if (win->surface)
+        blitSurface(win->surface, clip->x - win->r.x, clip->y - win->r.y, clip->w, clip->h, clip->x, clip->y);
+    else
+        win->paint(win->r.x, win->r.y, clip, win->ctx);
+}
+
+// Draw bounds bottom to top, for when a list overflowed
+static void draw_painter(const wm_rect_t *bounds)
+{
+    overflows++;
+    fillRect(bounds->x, bounds->y, bounds->w, bounds->h, background);
+    for (int i = 0; i < count; i++)
+    {
+        const window_t *win = &windows[order[i]];
+        wm_rect_t in;
+        if (intersect(&win->r, bounds, &in))
+            paint(win, &in);
+    }
+}
+
+// Draw area, using other as well. The windows above level (in order) have
+// not changed, so they are only cut out.
+static void draw(region_t *area, region_t *other, int level)
+{
+    if (area->count == 0 && !area->overflow)
+        return;
+
+    // Bounds of the area, for when it can't be drawn in order
+    int x0 = VGA_WIDTH, y0 = VGA_HEIGHT, x1 = 0, y1 = 0;
+    for (int i = 0; i < area->count; i++)
+    {
+        const wm_rect_t *r = &area->rects[i];
+        x0 = r->x < x0 ? r->x : x0;
+        y0 = r->y < y0 ? r->y : y0;
+        x1 = r->x + r->w > x1 ? r->x + r->w : x1;
+        y1 = r->y + r->h > y1 ? r->y + r->h : y1;
+    }
+    wm_rect_t bounds = {x0, y0, x1 - x0, y1 - y0};
+    if (area->overflow)
+    {
+        draw_painter(area->count ? &bounds : &screen);
+        return;
+    }
+
+    for (int i = count - 1; i >= 0 && area->count; i--)
+    {
+        const window_t *win = &windows[order[i]];
+        wm_rect_t in;
+
+        if (i <= level)
+            for (int j = 0; j < area->count; j++)
+                if (intersect(&area->rects[j], &win->r, &in))
+                    paint(win, &in);
+
+        subtract(area, &win->r, other);
+        if (other->overflow)
+        {
+            draw_painter(&bounds);
+            return;
+        }
+        region_t *t = area;
+        area = other;
+        other = t;
+    }
+
+    for (int j = 0; j < area->count; j++)
+    {
+        const wm_rect_t *r = &area->rects[j];
+        fillRect(r->x, r->y, r->w, r->h, background);
+    }
+}
+
+static bool valid(int id)
+{
+    return id >= 0 && id < WM_MAX_WINDOWS && windows[id].open;
+}
+
+// Position of a window in order
+static int level(int id)
+{
+    int i = 0;
+    while (order[i] != id)
+        i++;
+    return i;
+}
+
+void wm_init(char bg)
+{
+    for (int i = 0; i < WM_MAX_WINDOWS; i++)
+        windows[i].open = false;
+    count = 0;
+    background = bg;
+    fillRect(0, 0, VGA_WIDTH, VGA_HEIGHT, background);
+}
+
+static int open_window(const window_t *win)
+{
+    for (int id = 0; id < WM_MAX_WINDOWS; id++)
+        if (!windows[id].open)
+        {
+            windows[id] = *win;
+            order[count++] = id;
+            set(&lists[0], &win->r);
+            draw(&lists[0], &lists[1], count - 1);
+            return id;
+        }
+    return -1;
+}
+
+int wm_open_surface(int x, int y, const vga_surface_t *surface)
+{
+    window_t win = {{x, y, surface->width, surface->height}, surface, NULL, NULL, true};
+    return open_window(&win);
+}
+
+int wm_open(int x, int y, int w, int h, wm_paint_t paint, void *ctx)
+{
+    window_t win = {{x, y, w, h}, NULL, paint, ctx, true};
+    return open_window(&win);
+}
+
+void wm_close(int id)
+{
+    if (!valid(id))
+        return;
+
+    int i = level(id);
+    for (int j = i; j < count - 1; j++)
+        order[j] = order[j + 1];
+    count--;
+    windows[id].open = false;
+    set(&lists[0], &windows[id].r);
+    draw(&lists[0], &lists[1], i - 1);
+}
+
+void wm_move(int id, int x, int y)
+{
+    if (!valid(id))
+        return;
+
+    // What the old rectangle uncovers, plus the new one
+    window_t *win = &windows[id];
+    set(&lists[1], &win->r);
+    win->r.x = x;
+    win->r.y = y;
+    subtract(&lists[1], &win->r, &lists[0]);
+
+    wm_rect_t on;
+    if (intersect(&win->r, &screen, &on))
+        append(&lists[0], on.x, on.y, on.w, on.h);
+    draw(&lists[0], &lists[1], level(id));
+}
+
+void wm_raise(int id)
+{
+    if (!valid(id))
+        return;
+
+    // The part of the window that was visible
+    window_t *win = &windows[id];
+    int i = level(id);
+    region_t *visible = &lists[1], *spare = &lists[2];
+    set(visible, &win->r);
+    for (int j = i + 1; j < count; j++)
+    {
+        subtract(visible, &windows[order[j]].r, spare);
+        region_t *t = visible;
+        visible = spare;
+        spare = t;
+    }
+
+    for (; i < count - 1; i++)
+        order[i] = order[i + 1];
+    order[i] = id;
+
+    // Everything else of it is drawn, all of it if visible overflowed
+    region_t *hidden = &lists[0];
+    set(hidden, &win->r);
+    for (int j = 0; j < visible->count && !visible->overflow; j++)
+    {
+        subtract(hidden, &visible->rects[j], spare);
+        region_t *t = hidden;
+        hidden = spare;
+        spare = t;
+    }
+    draw(hidden, spare, count - 1);
+}
+
+void wm_damage(int id, int x, int y, int w, int h)
+{
+    if (!valid(id))
+        return;
+
+    const window_t *win = &windows[id];
+    wm_rect_t r = {win->r.x + x, win->r.y + y, w, h}, in;
+    lists[0].count = 0;
+    lists[0].overflow = false;
+    if (intersect(&r, &win->r, &in))
+        set(&lists[0], &in);
+    draw(&lists[0], &lists[1], level(id));
+}
+
+void wm_repaint(int x, int y, int w, int h)
+{
+    wm_rect_t r = {x, y, w, h};
+    set(&lists[0], &r);
+    draw(&lists[0], &lists[1], count - 1);
+}
+
+uint32_t wm_overflows(void)
+{
+    return overflows;
+}
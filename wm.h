@@ -0,0 +1,59 @@
+/**
+ * Overlapping windows on the framebuffer
+ *
+ * Windows are kept in z order, bottom first. Each shows a surface or is
+ * painted by a callback. Nothing is buffered per window: when part of the
+ * screen has to be redrawn, that area is turned into a list of rectangles,
+ * each window from the top down takes the rectangles it covers and cuts
+ * them out of the list, and what is left is background. Every pixel is so
+ * drawn once, by the window that shows there, with blitSurface() or the
+ * callback, and fillRect() for the background.
+ *
+ * Moving a window redraws its new rectangle and the part of the old one it
+ * uncovered. Raising one redraws the parts that windows above it covered.
+ * If a list runs out of room (complex overlaps of many windows), that area
+ * is drawn bottom to top instead, which is correct but slower.
+ */
+
+#ifndef WM_H
+#define WM_H
+
+#include "vga.h"
+
+#define WM_MAX_WINDOWS 8
+
+// Rectangles in a list. The three lists are static, 8 bytes a rectangle.
+#define WM_MAX_RECTS 32
+
+typedef struct
+{
+    short x, y, w, h;
+} wm_rect_t;
+
+// Draw the part clip (screen coordinates, already on screen) of a window
+// whose top left corner is at x, y. Nothing outside clip may be touched.
+typedef void (*wm_paint_t)(int x, int y, const wm_rect_t *clip, void *ctx);
+
+// Remove all windows and fill the screen with the background color
+void wm_init(char background);
+
+// Open a window on top of the others, showing a surface (at its own size)
+// or painted by a callback. Returns its id, -1 if there are too many.
+int wm_open_surface(int x, int y, const vga_surface_t *surface);
+int wm_open(int x, int y, int w, int h, wm_paint_t paint, void *ctx);
+
+void wm_close(int id);
+void wm_move(int id, int x, int y);
+void wm_raise(int id);
+
+// Redraw the visible part of a w x h area of a window (window coordinates)
+// after its content changed
+void wm_damage(int id, int x, int y, int w, int h);
+
+// Redraw a screen area
+void wm_repaint(int x, int y, int w, int h);
+
+// Areas drawn bottom to top because a rectangle list overflowed
+uint32_t wm_overflows(void);
+
+#endif